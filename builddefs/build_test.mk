@@ -6,6 +6,11 @@ endif
 
 OPT = g
 
+# Benchmarks are measured with the optimisations used for firmware builds
+ifeq ($(strip $(BENCHMARK)), yes)
+    OPT = s
+endif
+
 include paths.mk
 include $(BUILDDEFS_PATH)/message.mk
 
@@ -52,7 +57,11 @@ ifneq ($(strip $(DEBUG)), 0)
 CONSOLE_ENABLE = yes
 endif
 
-ifneq ($(filter $(FULL_TESTS),$(TEST)),)
+ifeq ($(strip $(BENCHMARK)), yes)
+include tests/test_common/build.mk
+include $(TEST_PATH)/bench.mk
+OPT_DEFS += -DBENCHMARK
+else ifneq ($(filter $(FULL_TESTS),$(TEST)),)
 include tests/test_common/build.mk
 include $(TEST_PATH)/test.mk
 endif
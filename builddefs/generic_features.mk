@@ -26,6 +26,7 @@ GENERIC_FEATURES = \
     COMBO \
     COMMAND \
     CRC \
+    DEADLINE_SCHEDULER \
     DEFERRED_EXEC \
     DIGITIZER \
     DIP_SWITCH \
@@ -44,6 +45,7 @@ GENERIC_FEATURES = \
     OS_DETECTION \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
+    SCAN_PROFILER \
     SECURE \
     SEND_STRING \
     SEQUENCER \
@@ -84,6 +84,8 @@ define GENERATE_MSG_MAKE_TEST
 endef
 MSG_MAKE_TEST = $(eval $(call GENERATE_MSG_MAKE_TEST))$(MSG_MAKE_TEST_ACTUAL)
 MSG_TEST = Testing $(BOLD)$(TEST_NAME)$(NO_COLOR)
+MSG_MAKE_BENCH = Making benchmark $(BOLD)$(TEST_NAME)$(NO_COLOR)
+MSG_BENCH = Benchmarking $(BOLD)$(TEST_NAME)$(NO_COLOR)
 define GENERATE_MSG_AVAILABLE_KEYMAPS
     MSG_AVAILABLE_KEYMAPS_ACTUAL := Available keymaps for $(BOLD)$$(CURRENT_KB)$(NO_COLOR):
 endef
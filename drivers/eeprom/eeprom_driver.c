@@ -83,3 +83,7 @@ void eeprom_driver_format(bool erase) {
     (void)erase; /* The default implementation assumes that the eeprom must be erased in order to be usable. */
     eeprom_driver_erase();
 }
+
+__attribute__((weak)) void eeprom_driver_task(void) {}
+
+__attribute__((weak)) void eeprom_driver_flush(void) {}
@@ -22,3 +22,8 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+// Background work for drivers that defer writes, called from the main loop
+void eeprom_driver_task(void);
+// Writes out anything the driver has deferred, before suspend or reset
+void eeprom_driver_flush(void);
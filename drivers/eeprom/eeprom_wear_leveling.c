@@ -6,6 +6,20 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+#    include "keyboard.h"
+
+// Time without input before queued writes are drained
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_IDLE_MS
+#        define WEAR_LEVELING_WRITE_BEHIND_IDLE_MS 250
+#    endif
+
+// Bytes of queued data written to the log per main loop iteration
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_BUDGET
+#        define WEAR_LEVELING_WRITE_BEHIND_BUDGET 8
+#    endif
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -27,3 +41,21 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
 }
+
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+void eeprom_driver_task(void) {
+    if (last_input_activity_elapsed() < WEAR_LEVELING_WRITE_BEHIND_IDLE_MS) {
+        return;
+    }
+
+    if (wear_leveling_pending()) {
+        wear_leveling_drain(WEAR_LEVELING_WRITE_BEHIND_BUDGET);
+    } else {
+        wear_leveling_consolidate_early();
+    }
+}
+
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+#endif // WEAR_LEVELING_WRITE_BEHIND
@@ -47,12 +47,14 @@
 
 typedef struct aw20216s_driver_t {
     uint8_t pwm_buffer[AW20216S_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty_start; // PWM registers [start, end) changed since the last update
+    uint8_t pwm_buffer_dirty_end;
 } PACKED aw20216s_driver_t;
 
 aw20216s_driver_t driver_buffers[AW20216S_DRIVER_COUNT] = {{
-    .pwm_buffer       = {0},
-    .pwm_buffer_dirty = false,
+    .pwm_buffer             = {0},
+    .pwm_buffer_dirty_start = 0,
+    .pwm_buffer_dirty_end   = 0,
 }};
 
 bool aw20216s_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
@@ -136,6 +138,17 @@ void aw20216s_init(pin_t cs_pin) {
     aw20216s_auto_lowpower(cs_pin);
 }
 
+static void aw20216s_set_pwm_dirty(uint8_t index, uint8_t reg) {
+    if (driver_buffers[index].pwm_buffer_dirty_start == driver_buffers[index].pwm_buffer_dirty_end) {
+        driver_buffers[index].pwm_buffer_dirty_start = reg;
+        driver_buffers[index].pwm_buffer_dirty_end   = reg + 1;
+    } else if (reg < driver_buffers[index].pwm_buffer_dirty_start) {
+        driver_buffers[index].pwm_buffer_dirty_start = reg;
+    } else if (reg >= driver_buffers[index].pwm_buffer_dirty_end) {
+        driver_buffers[index].pwm_buffer_dirty_end = reg + 1;
+    }
+}
+
 void aw20216s_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     aw20216s_led_t led;
     memcpy_P(&led, (&g_aw20216s_leds[index]), sizeof(led));
@@ -147,7 +160,10 @@ void aw20216s_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     driver_buffers[led.driver].pwm_buffer[led.r] = red;
     driver_buffers[led.driver].pwm_buffer[led.g] = green;
     driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-    driver_buffers[led.driver].pwm_buffer_dirty  = true;
+
+    aw20216s_set_pwm_dirty(led.driver, led.r);
+    aw20216s_set_pwm_dirty(led.driver, led.g);
+    aw20216s_set_pwm_dirty(led.driver, led.b);
 }
 
 void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -157,9 +173,14 @@ void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void aw20216s_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, 0, driver_buffers[index].pwm_buffer, AW20216S_PWM_REGISTER_COUNT);
-        driver_buffers[index].pwm_buffer_dirty = false;
+    uint8_t start = driver_buffers[index].pwm_buffer_dirty_start;
+    uint8_t end   = driver_buffers[index].pwm_buffer_dirty_end;
+
+    if (start != end) {
+        // Only transmit the span of registers that changed
+        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, start, driver_buffers[index].pwm_buffer + start, end - start);
+        driver_buffers[index].pwm_buffer_dirty_start = 0;
+        driver_buffers[index].pwm_buffer_dirty_end   = 0;
     }
 }
 
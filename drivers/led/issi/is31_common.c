@@ -0,0 +1,110 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include "is31_common.h"
+
+static is31_device_t *devices = NULL;
+
+void is31_common_init_device(is31_device_t *device, const is31_chip_t *chip, uint8_t address, uint8_t *pwm_buffer, uint16_t timeout, uint8_t persistence) {
+    device->chip        = chip;
+    device->pwm_buffer  = pwm_buffer;
+    device->pwm_dirty   = 0;
+    device->timeout     = timeout;
+    device->persistence = persistence;
+    device->address     = address;
+
+    // Drivers may be initialised more than once
+    for (is31_device_t *d = devices; d != NULL; d = d->next) {
+        if (d == device) {
+            return;
+        }
+    }
+
+    device->next = devices;
+    devices      = device;
+}
+
+void is31_common_set_pwm_dirty(is31_device_t *device, uint16_t offset) {
+    const is31_pwm_page_t *page     = device->chip->pages;
+    uint8_t                transfer = 0;
+
+    while (offset >= page->count) {
+        offset -= page->count;
+        transfer += page->count / page->transfer_size;
+        page++;
+    }
+
+    device->pwm_dirty |= 1U << (transfer + offset / page->transfer_size);
+}
+
+static void is31_common_write(is31_device_t *device, uint8_t reg, const uint8_t *data, uint8_t length) {
+#ifdef I2C_ASYNC_ENABLE
+    i2c_transaction_write_register(&device->transactions[device->transactions_queued++], device->address << 1, reg, data, length, device->timeout);
+#else
+    uint8_t attempts = device->persistence ? device->persistence : 1;
+    for (uint8_t i = 0; i < attempts; i++) {
+        if (i2c_write_register(device->address << 1, reg, data, length, device->timeout) == I2C_STATUS_SUCCESS) break;
+    }
+#endif
+}
+
+void is31_common_update_pwm(is31_device_t *device) {
+    if (!device->pwm_dirty) {
+        return;
+    }
+
+#ifdef I2C_ASYNC_ENABLE
+    // Stay dirty and try again on the next flush while the bus is still busy with the previous frame
+    if (device->transactions_queued && !i2c_transaction_is_complete(&device->transactions[device->transactions_queued - 1])) {
+        return;
+    }
+    device->transactions_queued = 0;
+#endif
+
+    const is31_chip_t *chip     = device->chip;
+    const uint8_t     *buffer   = device->pwm_buffer;
+    uint8_t            transfer = 0;
+
+    for (uint8_t p = 0; p < chip->page_count; p++) {
+        const is31_pwm_page_t *page      = &chip->pages[p];
+        uint8_t                transfers = page->count / page->transfer_size;
+        uint16_t               mask      = (uint16_t)((1UL << transfers) - 1) << transfer;
+
+        // Skip the page select when nothing on the page changed
+        if ((device->pwm_dirty & mask) && chip->command_register != IS31_NO_REGISTER) {
+            if (chip->write_lock_register != IS31_NO_REGISTER) {
+                is31_common_write(device, chip->write_lock_register, &chip->write_lock_magic, 1);
+            }
+            is31_common_write(device, chip->command_register, &page->page, 1);
+        }
+
+        for (uint8_t i = 0; i < page->count; i += page->transfer_size, transfer++) {
+            if (device->pwm_dirty & (1U << transfer)) {
+                is31_common_write(device, page->first_register + i, buffer + i, page->transfer_size);
+            }
+        }
+
+        buffer += page->count;
+    }
+
+    if (chip->update_register != IS31_NO_REGISTER) {
+        // Load PWM registers and LED Control register data
+        static const uint8_t update = 0x01;
+        is31_common_write(device, chip->update_register, &update, 1);
+    }
+
+#ifdef I2C_ASYNC_ENABLE
+    if (!i2c_transaction_submit_chain(device->transactions, device->transactions_queued)) {
+        return;
+    }
+#endif
+
+    device->pwm_dirty = 0;
+}
+
+void is31_common_flush(void) {
+    for (is31_device_t *device = devices; device != NULL; device = device->next) {
+        is31_common_update_pwm(device);
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_master.h"
+
+/**
+ * \file
+ *
+ * \defgroup is31_common Shared PWM engine for ISSI style LED drivers
+ *
+ * \brief Buffers, dirty tracking and I2C upload of PWM registers, shared by
+ * the IS31FL3xxx and SNLED27351 drivers.
+ *
+ * Each chip describes its PWM registers once with a constant `is31_chip_t`,
+ * and every chip on the bus is registered as an `is31_device_t`. Devices of
+ * different chip types can share a bus, and is31_common_flush() uploads all
+ * of them in one pass.
+ *
+ * \{
+ */
+
+#define IS31_NO_REGISTER 0xFF
+
+#define IS31_MAX_PWM_PAGES 2
+
+// One bit of is31_device_t.pwm_dirty per PWM transfer, each chip driver asserts that its pages fit
+#define IS31_MAX_PWM_TRANSFERS 16
+
+/**
+ * \brief A contiguous block of PWM registers on one page
+ */
+typedef struct {
+    uint8_t page;           // Value written to the command register to select the page
+    uint8_t first_register; // Address of the first PWM register on the page
+    uint8_t count;          // Number of PWM registers on the page
+    uint8_t transfer_size;  // PWM registers sent per I2C transfer, must divide count
+} is31_pwm_page_t;
+
+/**
+ * \brief Register map of a chip's PWM registers
+ */
+typedef struct {
+    uint8_t         command_register;    // IS31_NO_REGISTER if the PWM registers are always accessible
+    uint8_t         write_lock_register; // IS31_NO_REGISTER if the command register is not write locked
+    uint8_t         write_lock_magic;
+    uint8_t         update_register; // IS31_NO_REGISTER if PWM values take effect immediately
+    uint8_t         page_count;
+    is31_pwm_page_t pages[IS31_MAX_PWM_PAGES];
+} is31_chip_t;
+
+typedef struct is31_device_t is31_device_t;
+
+/**
+ * \brief One chip on the bus, filled in by is31_common_init_device()
+ */
+struct is31_device_t {
+    const is31_chip_t *chip;
+    uint8_t           *pwm_buffer; // PWM registers of all pages, back to back
+    uint16_t           pwm_dirty;  // One bit per PWM transfer, in page order
+    uint16_t           timeout;
+    uint8_t            persistence;
+    uint8_t            address;
+    is31_device_t     *next;
+#ifdef I2C_ASYNC_ENABLE
+    // Write lock and page select per page, the PWM transfers and the update register
+    i2c_transaction_t transactions[IS31_MAX_PWM_PAGES * 2 + IS31_MAX_PWM_TRANSFERS + 1];
+    uint8_t           transactions_queued;
+#endif
+};
+
+/**
+ * \brief Sets up a device and adds it to the devices flushed by is31_common_flush()
+ *
+ * \param address the 7-bit I2C address
+ * \param pwm_buffer buffer holding the PWM registers of every page of the chip, back to back
+ * \param persistence number of attempts per transfer, 0 for a single attempt
+ */
+void is31_common_init_device(is31_device_t *device, const is31_chip_t *chip, uint8_t address, uint8_t *pwm_buffer, uint16_t timeout, uint8_t persistence);
+
+/**
+ * \brief Marks a PWM register for the next update
+ *
+ * \param offset index of the register in the device's PWM buffer
+ */
+void is31_common_set_pwm_dirty(is31_device_t *device, uint16_t offset);
+
+/**
+ * \brief Sends the PWM registers that changed since the last update
+ *
+ * Only the pages and transfers that contain a changed register are sent.
+ * With I2C_ASYNC_ENABLE the transfers are queued instead, and the device
+ * stays dirty while its previous upload is still in flight.
+ */
+void is31_common_update_pwm(is31_device_t *device);
+
+/**
+ * \brief Updates the PWM registers of every registered device, whatever the chip type
+ *
+ * This is the flush used by the RGB Matrix and LED Matrix drivers for the ISSI and SNLED chips.
+ */
+void is31_common_flush(void);
+
+/** \} */
@@ -16,6 +16,7 @@
 
 #include "is31fl3218-mono.h"
 #include "i2c_master.h"
+#include "is31_common.h"
 #include "gpio.h"
 
 #define IS31FL3218_PWM_REGISTER_COUNT 18
@@ -31,19 +32,28 @@
 
 typedef struct is31fl3218_driver_t {
     uint8_t pwm_buffer[IS31FL3218_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[IS31FL3218_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3218_driver_t;
 
 // IS31FL3218 has 18 PWM outputs and a fixed I2C address, so no chaining.
-is31fl3218_driver_t driver_buffers = {
+static is31fl3218_driver_t driver_buffers = {
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 };
 
+static const is31_chip_t pwm_chip = {
+    .command_register    = IS31_NO_REGISTER,
+    .write_lock_register = IS31_NO_REGISTER,
+    .update_register     = IS31FL3218_REG_UPDATE,
+    .page_count          = 1,
+    .pages               = {{.first_register = IS31FL3218_REG_PWM, .count = IS31FL3218_PWM_REGISTER_COUNT, .transfer_size = 6}},
+};
+_Static_assert(IS31FL3218_PWM_REGISTER_COUNT / 6 <= IS31_MAX_PWM_TRANSFERS, "Too many PWM transfers to track in is31_device_t");
+
+static is31_device_t pwm_device;
+
 void is31fl3218_write_register(uint8_t reg, uint8_t data) {
 #if IS31FL3218_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3218_I2C_PERSISTENCE; i++) {
@@ -54,19 +64,11 @@ void is31fl3218_write_register(uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3218_write_pwm_buffer(void) {
-#if IS31FL3218_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3218_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-    }
-#else
-    i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT);
-#endif
-}
-
 void is31fl3218_init(void) {
     i2c_init();
 
+    is31_common_init_device(&pwm_device, &pwm_chip, IS31FL3218_I2C_ADDRESS, driver_buffers.pwm_buffer, IS31FL3218_I2C_TIMEOUT, IS31FL3218_I2C_PERSISTENCE);
+
 #if defined(IS31FL3218_SDB_PIN)
     gpio_set_pin_output(IS31FL3218_SDB_PIN);
     gpio_write_pin_high(IS31FL3218_SDB_PIN);
@@ -109,7 +111,7 @@ void is31fl3218_set_value(int index, uint8_t value) {
         }
 
         driver_buffers.pwm_buffer[led.v] = value;
-        driver_buffers.pwm_buffer_dirty  = true;
+        is31_common_set_pwm_dirty(&pwm_device, led.v);
     }
 }
 
@@ -136,13 +138,7 @@ void is31fl3218_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3218_update_pwm_buffers(void) {
-    if (driver_buffers.pwm_buffer_dirty) {
-        is31fl3218_write_pwm_buffer();
-        // Load PWM registers and LED Control register data
-        is31fl3218_write_register(IS31FL3218_REG_UPDATE, 0x01);
-
-        driver_buffers.pwm_buffer_dirty = false;
-    }
+    is31_common_update_pwm(&pwm_device);
 }
 
 void is31fl3218_update_led_control_registers(void) {
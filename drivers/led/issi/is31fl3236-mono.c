@@ -3,6 +3,7 @@
 
 #include "is31fl3236-mono.h"
 #include "i2c_master.h"
+#include "is31_common.h"
 #include "gpio.h"
 
 #define IS31FL3236_PWM_REGISTER_COUNT 36
@@ -20,7 +21,7 @@
 #    define IS31FL3236_PWM_FREQUENCY IS31FL3236_PWM_FREQUENCY_3K_HZ // OFS - IS31FL3236A only
 #endif
 
-const uint8_t i2c_addresses[IS31FL3236_DRIVER_COUNT] = {
+static const uint8_t i2c_addresses[IS31FL3236_DRIVER_COUNT] = {
     IS31FL3236_I2C_ADDRESS_1,
 #ifdef IS31FL3236_I2C_ADDRESS_2
     IS31FL3236_I2C_ADDRESS_2,
@@ -35,18 +36,27 @@ const uint8_t i2c_addresses[IS31FL3236_DRIVER_COUNT] = {
 
 typedef struct is31fl3236_driver_t {
     uint8_t pwm_buffer[IS31FL3236_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[IS31FL3236_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3236_driver_t;
 
-is31fl3236_driver_t driver_buffers[IS31FL3236_DRIVER_COUNT] = {{
+static is31fl3236_driver_t driver_buffers[IS31FL3236_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
 
+static const is31_chip_t pwm_chip = {
+    .command_register    = IS31_NO_REGISTER,
+    .write_lock_register = IS31_NO_REGISTER,
+    .update_register     = IS31FL3236_REG_UPDATE,
+    .page_count          = 1,
+    .pages               = {{.first_register = IS31FL3236_REG_PWM, .count = IS31FL3236_PWM_REGISTER_COUNT, .transfer_size = 12}},
+};
+_Static_assert(IS31FL3236_PWM_REGISTER_COUNT / 12 <= IS31_MAX_PWM_TRANSFERS, "Too many PWM transfers to track in is31_device_t");
+
+static is31_device_t pwm_devices[IS31FL3236_DRIVER_COUNT];
+
 void is31fl3236_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #if IS31FL3236_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3236_I2C_PERSISTENCE; i++) {
@@ -57,16 +67,6 @@ void is31fl3236_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3236_write_pwm_buffer(uint8_t index) {
-#if IS31FL3236_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3236_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-    }
-#else
-    i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT);
-#endif
-}
-
 void is31fl3236_init_drivers(void) {
     i2c_init();
 
@@ -89,6 +89,8 @@ void is31fl3236_init_drivers(void) {
 }
 
 void is31fl3236_init(uint8_t index) {
+    is31_common_init_device(&pwm_devices[index], &pwm_chip, i2c_addresses[index], driver_buffers[index].pwm_buffer, IS31FL3236_I2C_TIMEOUT, IS31FL3236_I2C_PERSISTENCE);
+
     // In case we ever want to reinitialize (?)
     is31fl3236_write_register(index, IS31FL3236_REG_RESET, 0x00);
 
@@ -123,7 +125,7 @@ void is31fl3236_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        is31_common_set_pwm_dirty(&pwm_devices[led.driver], led.v);
     }
 }
 
@@ -142,13 +144,7 @@ void is31fl3236_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3236_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3236_write_pwm_buffer(index);
-        // Load PWM registers and LED Control register data
-        is31fl3236_write_register(index, IS31FL3236_REG_UPDATE, 0x01);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
-    }
+    is31_common_update_pwm(&pwm_devices[index]);
 }
 
 void is31fl3236_update_led_control_registers(uint8_t index) {
@@ -18,6 +18,7 @@
 
 #include "is31fl3729.h"
 #include "i2c_master.h"
+#include "is31_common.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -64,7 +65,7 @@
 #    define IS31FL3729_PWM_FREQUENCY IS31FL3729_PWM_FREQUENCY_32K_HZ
 #endif
 
-const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
+static const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
     IS31FL3729_I2C_ADDRESS_1,
 #ifdef IS31FL3729_I2C_ADDRESS_2
     IS31FL3729_I2C_ADDRESS_2,
@@ -81,18 +82,27 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
     uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
     uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
 } PACKED is31fl3729_driver_t;
 
-is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
+static is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
 
+static const is31_chip_t pwm_chip = {
+    .command_register    = IS31_NO_REGISTER,
+    .write_lock_register = IS31_NO_REGISTER,
+    .update_register     = IS31_NO_REGISTER,
+    .page_count          = 1,
+    .pages               = {{.page = 0, .first_register = IS31FL3729_REG_PWM, .count = IS31FL3729_PWM_REGISTER_COUNT, .transfer_size = 13}},
+};
+_Static_assert(IS31FL3729_PWM_REGISTER_COUNT / 13 <= IS31_MAX_PWM_TRANSFERS, "Too many PWM transfers to track in is31_device_t");
+
+static is31_device_t pwm_devices[IS31FL3729_DRIVER_COUNT];
+
 void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #if IS31FL3729_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3729_I2C_PERSISTENCE; i++) {
@@ -103,21 +113,6 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3729_write_pwm_buffer(uint8_t index) {
-    // Transmit PWM registers in 11 transfers of 13 bytes.
-
-    // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
-#if IS31FL3729_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
-#endif
-    }
-}
-
 void is31fl3729_init_drivers(void) {
     i2c_init();
 
@@ -140,6 +135,8 @@ void is31fl3729_init_drivers(void) {
 }
 
 void is31fl3729_init(uint8_t index) {
+    is31_common_init_device(&pwm_devices[index], &pwm_chip, i2c_addresses[index], driver_buffers[index].pwm_buffer, IS31FL3729_I2C_TIMEOUT, IS31FL3729_I2C_PERSISTENCE);
+
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, shutdown is enabled last.
     // Set up the mode and other settings, clear the PWM registers,
@@ -167,7 +164,10 @@ void is31fl3729_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+
+        is31_common_set_pwm_dirty(&pwm_devices[led.driver], led.r);
+        is31_common_set_pwm_dirty(&pwm_devices[led.driver], led.g);
+        is31_common_set_pwm_dirty(&pwm_devices[led.driver], led.b);
     }
 }
 
@@ -195,11 +195,7 @@ void is31fl3729_set_scaling_register(uint8_t index, uint8_t red, uint8_t green,
 }
 
 void is31fl3729_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3729_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
-    }
+    is31_common_update_pwm(&pwm_devices[index]);
 }
 
 void is31fl3729_update_scaling_registers(uint8_t index) {
@@ -19,6 +19,7 @@
 
 #include "is31fl3737-mono.h"
 #include "i2c_master.h"
+#include "is31_common.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -49,7 +50,7 @@
 #    define IS31FL3737_GLOBAL_CURRENT 0xFF
 #endif
 
-const uint8_t i2c_addresses[IS31FL3737_DRIVER_COUNT] = {
+static const uint8_t i2c_addresses[IS31FL3737_DRIVER_COUNT] = {
     IS31FL3737_I2C_ADDRESS_1,
 #ifdef IS31FL3737_I2C_ADDRESS_2
     IS31FL3737_I2C_ADDRESS_2,
@@ -66,22 +67,32 @@ const uint8_t i2c_addresses[IS31FL3737_DRIVER_COUNT] = {
 // The control buffers match the page 0 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3737_write_pwm_buffer() but it's
+// buffers and the transfers in is31_common_update_pwm() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3737_driver_t {
     uint8_t pwm_buffer[IS31FL3737_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[IS31FL3737_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3737_driver_t;
 
-is31fl3737_driver_t driver_buffers[IS31FL3737_DRIVER_COUNT] = {{
+static is31fl3737_driver_t driver_buffers[IS31FL3737_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
 
+static const is31_chip_t pwm_chip = {
+    .command_register    = IS31FL3737_REG_COMMAND,
+    .write_lock_register = IS31FL3737_REG_COMMAND_WRITE_LOCK,
+    .write_lock_magic    = IS31FL3737_COMMAND_WRITE_LOCK_MAGIC,
+    .update_register     = IS31_NO_REGISTER,
+    .page_count          = 1,
+    .pages               = {{.page = IS31FL3737_COMMAND_PWM, .first_register = 0x00, .count = IS31FL3737_PWM_REGISTER_COUNT, .transfer_size = 16}},
+};
+_Static_assert(IS31FL3737_PWM_REGISTER_COUNT / 16 <= IS31_MAX_PWM_TRANSFERS, "Too many PWM transfers to track in is31_device_t");
+
+static is31_device_t pwm_devices[IS31FL3737_DRIVER_COUNT];
+
 void is31fl3737_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #if IS31FL3737_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3737_I2C_PERSISTENCE; i++) {
@@ -97,22 +108,6 @@ void is31fl3737_select_page(uint8_t index, uint8_t page) {
     is31fl3737_write_register(index, IS31FL3737_REG_COMMAND, page);
 }
 
-void is31fl3737_write_pwm_buffer(uint8_t index) {
-    // Assumes page 1 is already selected.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
-
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3737_PWM_REGISTER_COUNT; i += 16) {
-#if IS31FL3737_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3737_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3737_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3737_I2C_TIMEOUT);
-#endif
-    }
-}
-
 void is31fl3737_init_drivers(void) {
     i2c_init();
 
@@ -135,6 +130,8 @@ void is31fl3737_init_drivers(void) {
 }
 
 void is31fl3737_init(uint8_t index) {
+    is31_common_init_device(&pwm_devices[index], &pwm_chip, i2c_addresses[index], driver_buffers[index].pwm_buffer, IS31FL3737_I2C_TIMEOUT, IS31FL3737_I2C_PERSISTENCE);
+
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, shutdown is enabled last.
     // Set up the mode and other settings, clear the PWM registers,
@@ -181,7 +178,8 @@ void is31fl3737_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+
+        is31_common_set_pwm_dirty(&pwm_devices[led.driver], led.v);
     }
 }
 
@@ -208,13 +206,7 @@ void is31fl3737_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3737_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3737_select_page(index, IS31FL3737_COMMAND_PWM);
-
-        is31fl3737_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
-    }
+    is31_common_update_pwm(&pwm_devices[index]);
 }
 
 void is31fl3737_update_led_control_registers(uint8_t index) {
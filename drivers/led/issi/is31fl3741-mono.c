@@ -19,6 +19,7 @@
 
 #include "is31fl3741-mono.h"
 #include "i2c_master.h"
+#include "is31_common.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -55,7 +56,7 @@
 #    define IS31FL3741_GLOBAL_CURRENT 0xFF
 #endif
 
-const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
+static const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
     IS31FL3741_I2C_ADDRESS_1,
 #ifdef IS31FL3741_I2C_ADDRESS_2
     IS31FL3741_I2C_ADDRESS_2,
@@ -72,26 +73,37 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // The scaling buffers match the page 2 and 3 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
+// buffers and the transfers in is31_common_update_pwm() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3741_driver_t {
-    uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
-    uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer[IS31FL3741_PWM_0_REGISTER_COUNT + IS31FL3741_PWM_1_REGISTER_COUNT]; // PWM0 followed by PWM1
     uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
     uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
 } PACKED is31fl3741_driver_t;
 
-is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
-    .pwm_buffer_0         = {0},
-    .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+static is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
+    .pwm_buffer           = {0},
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
 }};
 
+static const is31_chip_t pwm_chip = {
+    .command_register    = IS31FL3741_REG_COMMAND,
+    .write_lock_register = IS31FL3741_REG_COMMAND_WRITE_LOCK,
+    .write_lock_magic    = IS31FL3741_COMMAND_WRITE_LOCK_MAGIC,
+    .update_register     = IS31_NO_REGISTER,
+    .page_count          = 2,
+    .pages               = {
+        {.page = IS31FL3741_COMMAND_PWM_0, .first_register = 0x00, .count = IS31FL3741_PWM_0_REGISTER_COUNT, .transfer_size = 30},
+        {.page = IS31FL3741_COMMAND_PWM_1, .first_register = 0x00, .count = IS31FL3741_PWM_1_REGISTER_COUNT, .transfer_size = 19},
+    },
+};
+_Static_assert(IS31FL3741_PWM_0_REGISTER_COUNT / 30 + IS31FL3741_PWM_1_REGISTER_COUNT / 19 <= IS31_MAX_PWM_TRANSFERS, "Too many PWM transfers to track in is31_device_t");
+
+static is31_device_t pwm_devices[IS31FL3741_DRIVER_COUNT];
+
 void is31fl3741_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
@@ -107,38 +119,6 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
     is31fl3741_write_register(index, IS31FL3741_REG_COMMAND, page);
 }
 
-void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
-
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
-
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
-#endif
-    }
-
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
-
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
-
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
-#endif
-    }
-}
-
 void is31fl3741_init_drivers(void) {
     i2c_init();
 
@@ -161,6 +141,8 @@ void is31fl3741_init_drivers(void) {
 }
 
 void is31fl3741_init(uint8_t index) {
+    is31_common_init_device(&pwm_devices[index], &pwm_chip, i2c_addresses[index], driver_buffers[index].pwm_buffer, IS31FL3741_I2C_TIMEOUT, IS31FL3741_I2C_PERSISTENCE);
+
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, shutdown is enabled last.
     // Set up the mode and other settings, clear the PWM registers,
@@ -185,20 +167,18 @@ void is31fl3741_init(uint8_t index) {
     wait_ms(10);
 }
 
-uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
-    if (reg & 0x100) {
-        return driver_buffers[driver].pwm_buffer_1[reg & 0xFF];
-    } else {
-        return driver_buffers[driver].pwm_buffer_0[reg];
-    }
+// PWM1 registers are addressed as 0x100 + register
+static uint16_t pwm_offset(uint16_t reg) {
+    return (reg & 0x100) ? IS31FL3741_PWM_0_REGISTER_COUNT + (reg & 0xFF) : reg;
 }
 
-void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
-    if (reg & 0x100) {
-        driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
-    } else {
-        driver_buffers[driver].pwm_buffer_0[reg] = value;
-    }
+static uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
+    return driver_buffers[driver].pwm_buffer[pwm_offset(reg)];
+}
+
+static void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
+    driver_buffers[driver].pwm_buffer[pwm_offset(reg)] = value;
+    is31_common_set_pwm_dirty(&pwm_devices[driver], pwm_offset(reg));
 }
 
 void is31fl3741_set_value(int index, uint8_t value) {
@@ -212,7 +192,6 @@ void is31fl3741_set_value(int index, uint8_t value) {
         }
 
         set_pwm_value(led.driver, led.v, value);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -240,16 +219,11 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
-    }
+    is31_common_update_pwm(&pwm_devices[index]);
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value) {
     set_pwm_value(pled->driver, pled->v, value);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
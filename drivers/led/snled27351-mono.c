@@ -16,6 +16,7 @@
 
 #include "snled27351-mono.h"
 #include "i2c_master.h"
+#include "is31_common.h"
 #include "gpio.h"
 
 #define SNLED27351_PWM_REGISTER_COUNT 192
@@ -38,7 +39,7 @@
         { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }
 #endif
 
-const uint8_t i2c_addresses[SNLED27351_DRIVER_COUNT] = {
+static const uint8_t i2c_addresses[SNLED27351_DRIVER_COUNT] = {
     SNLED27351_I2C_ADDRESS_1,
 #ifdef SNLED27351_I2C_ADDRESS_2
     SNLED27351_I2C_ADDRESS_2,
@@ -55,22 +56,31 @@ const uint8_t i2c_addresses[SNLED27351_DRIVER_COUNT] = {
 // The control buffers match the PG0 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in snled27351_write_pwm_buffer() but it's
+// buffers and the transfers in is31_common_update_pwm() but it's
 // probably not worth the extra complexity.
 typedef struct snled27351_driver_t {
     uint8_t pwm_buffer[SNLED27351_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[SNLED27351_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED snled27351_driver_t;
 
-snled27351_driver_t driver_buffers[SNLED27351_DRIVER_COUNT] = {{
+static snled27351_driver_t driver_buffers[SNLED27351_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
 
+static const is31_chip_t pwm_chip = {
+    .command_register    = SNLED27351_REG_COMMAND,
+    .write_lock_register = IS31_NO_REGISTER,
+    .update_register     = IS31_NO_REGISTER,
+    .page_count          = 1,
+    .pages               = {{.page = SNLED27351_COMMAND_PWM, .first_register = 0x00, .count = SNLED27351_PWM_REGISTER_COUNT, .transfer_size = 16}},
+};
+_Static_assert(SNLED27351_PWM_REGISTER_COUNT / 16 <= IS31_MAX_PWM_TRANSFERS, "Too many PWM transfers to track in is31_device_t");
+
+static is31_device_t pwm_devices[SNLED27351_DRIVER_COUNT];
+
 void snled27351_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #if SNLED27351_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < SNLED27351_I2C_PERSISTENCE; i++) {
@@ -85,22 +95,6 @@ void snled27351_select_page(uint8_t index, uint8_t page) {
     snled27351_write_register(index, SNLED27351_REG_COMMAND, page);
 }
 
-void snled27351_write_pwm_buffer(uint8_t index) {
-    // Assumes PG1 is already selected.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
-
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < SNLED27351_PWM_REGISTER_COUNT; i += 16) {
-#if SNLED27351_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < SNLED27351_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, SNLED27351_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, SNLED27351_I2C_TIMEOUT);
-#endif
-    }
-}
-
 void snled27351_init_drivers(void) {
     i2c_init();
 
@@ -123,6 +117,8 @@ void snled27351_init_drivers(void) {
 }
 
 void snled27351_init(uint8_t index) {
+    is31_common_init_device(&pwm_devices[index], &pwm_chip, i2c_addresses[index], driver_buffers[index].pwm_buffer, SNLED27351_I2C_TIMEOUT, SNLED27351_I2C_PERSISTENCE);
+
     snled27351_select_page(index, SNLED27351_COMMAND_FUNCTION);
 
     // Setting LED driver to shutdown mode
@@ -179,7 +175,8 @@ void snled27351_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+
+        is31_common_set_pwm_dirty(&pwm_devices[led.driver], led.v);
     }
 }
 
@@ -206,13 +203,7 @@ void snled27351_set_led_control_register(uint8_t index, bool value) {
 }
 
 void snled27351_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        snled27351_select_page(index, SNLED27351_COMMAND_PWM);
-
-        snled27351_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
-    }
+    is31_common_update_pwm(&pwm_devices[index]);
 }
 
 void snled27351_update_led_control_registers(uint8_t index) {
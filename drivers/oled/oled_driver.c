@@ -165,6 +165,12 @@ uint32_t oled_scroll_timeout;
 #if OLED_UPDATE_INTERVAL > 0
 uint16_t oled_update_timeout;
 #endif
+#ifdef OLED_SHADOW_BUFFER
+// Copy of what the display memory currently holds, so only changed bytes are sent.
+// Blocks in oled_shadow_stale have unknown display contents and are sent in full.
+static uint8_t         oled_shadow[OLED_MATRIX_SIZE];
+static OLED_BLOCK_TYPE oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
 
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
@@ -362,6 +368,10 @@ bool oled_init(oled_rotation_t rotation) {
     oled_scroll_timeout = timer_read32() + OLED_SCROLL_TIMEOUT;
 #endif
 
+#ifdef OLED_SHADOW_BUFFER
+    oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
+
     oled_clear();
     oled_initialized = true;
     oled_active      = true;
@@ -446,6 +456,83 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+#ifdef OLED_SHADOW_BUFFER
+static bool shadow_block_unchanged(uint8_t block) {
+    return !(oled_shadow_stale & ((OLED_BLOCK_TYPE)1 << block)) && memcmp(&oled_buffer[OLED_BLOCK_SIZE * block], &oled_shadow[OLED_BLOCK_SIZE * block], OLED_BLOCK_SIZE) == 0;
+}
+
+static void shadow_block_sent(uint8_t block) {
+    memcpy(&oled_shadow[OLED_BLOCK_SIZE * block], &oled_buffer[OLED_BLOCK_SIZE * block], OLED_BLOCK_SIZE);
+    oled_shadow_stale &= ~((OLED_BLOCK_TYPE)1 << block);
+}
+
+// Sends the buffer bytes in [start, end), which must all be on the same page
+static bool send_window(uint16_t start, uint16_t end) {
+    uint8_t page   = start / OLED_DISPLAY_WIDTH;
+    uint8_t column = start % OLED_DISPLAY_WIDTH + OLED_COLUMN_OFFSET;
+#    if OLED_IC_HAS_HORIZONTAL_MODE
+    uint8_t window[] = {I2C_CMD, COLUMN_ADDR, column, column + (end - start) - 1, PAGE_ADDR, page, page};
+#    else
+    uint8_t window[] = {I2C_CMD, PAM_PAGE_ADDR | page, PAM_SETCOLUMN_LSB | (column & 0x0f), PAM_SETCOLUMN_MSB | (column >> 4 & 0x0f)};
+#    endif
+    if (!oled_send_cmd(window, ARRAY_SIZE(window))) {
+        print("oled_render offset command failed\n");
+        return false;
+    }
+
+    if (!oled_send_data(&oled_buffer[start], end - start)) {
+        print("oled_render data failed\n");
+        return false;
+    }
+
+    memcpy(&oled_shadow[start], &oled_buffer[start], end - start);
+    return true;
+}
+
+// Sends only the bytes of the dirty blocks that differ from the shadow buffer. Changed
+// bytes on the same page are coalesced into one window when the unchanged bytes between
+// them are cheaper to resend than another addressing command.
+static bool render_shadow_diff(bool all) {
+    uint16_t start         = 0;
+    uint16_t end           = 0; // No pending window while start == end
+    uint8_t  num_processed = 0;
+
+    for (uint8_t block = 0; block < OLED_BLOCK_COUNT && oled_dirty && (num_processed < OLED_UPDATE_PROCESS_LIMIT || all); block++) {
+        if (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << block))) {
+            continue;
+        }
+
+        bool stale   = oled_shadow_stale & ((OLED_BLOCK_TYPE)1 << block);
+        bool changed = false;
+        for (uint16_t i = OLED_BLOCK_SIZE * block; i < OLED_BLOCK_SIZE * (block + 1); i++) {
+            if (!stale && oled_buffer[i] == oled_shadow[i]) {
+                continue;
+            }
+            changed = true;
+
+            if (start != end && i / OLED_DISPLAY_WIDTH == start / OLED_DISPLAY_WIDTH && i - end <= OLED_SHADOW_MERGE_GAP) {
+                end = i + 1;
+                continue;
+            }
+
+            if (start != end && !send_window(start, end)) {
+                return false;
+            }
+            start = i;
+            end   = i + 1;
+        }
+
+        if (changed) {
+            num_processed++;
+        }
+        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << block);
+        oled_shadow_stale &= ~((OLED_BLOCK_TYPE)1 << block);
+    }
+
+    return start == end || send_window(start, end);
+}
+#endif
+
 void oled_render_dirty(bool all) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
@@ -456,6 +543,17 @@ void oled_render_dirty(bool all) {
     // Turn on display if it is off
     oled_on();
 
+#ifdef OLED_SHADOW_BUFFER
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        if (!render_shadow_diff(all)) {
+            // The display contents of the failed window are unknown, resend everything
+            oled_dirty        = OLED_ALL_BLOCKS_MASK;
+            oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+        }
+        return;
+    }
+#endif
+
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
     while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
@@ -464,6 +562,15 @@ void oled_render_dirty(bool all) {
             ++update_start;
         }
 
+#ifdef OLED_SHADOW_BUFFER
+        // Skip rotating and sending blocks that were redrawn with the same contents
+        if (shadow_block_unchanged(update_start)) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            num_processed--;
+            continue;
+        }
+#endif
+
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
         static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
@@ -527,6 +634,10 @@ void oled_render_dirty(bool all) {
 #endif
         }
 
+#ifdef OLED_SHADOW_BUFFER
+        shadow_block_sent(update_start);
+#endif
+
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
@@ -878,6 +989,10 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+#ifdef OLED_SHADOW_BUFFER
+        // Scrolling moved the contents of the display memory
+        oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
     }
     return !oled_scrolling;
 }
@@ -321,6 +321,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+// With OLED_SHADOW_BUFFER, unchanged bytes between two changes on a page are
+// resent when there are no more than this many, instead of a new window command
+#if !defined(OLED_SHADOW_MERGE_GAP)
+#    define OLED_SHADOW_MERGE_GAP 8
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
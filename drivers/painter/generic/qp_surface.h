@@ -21,6 +21,22 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECT_COUNT
+/**
+ * @def This controls the maximum number of separate dirty rectangles each surface tracks. Drawing into more areas than
+ *      this merges the two closest rectangles, so at most this many viewport changes are made per transfer.
+ */
+#    define SURFACE_DIRTY_RECT_COUNT 4
+#endif
+
+#ifndef SURFACE_DIRTY_RECT_MERGE_COST
+/**
+ * @def The number of extra, unchanged pixels worth transferring to save a separate viewport change. Dirty rectangles are
+ *      merged when their combined bounding box adds no more than this many pixels.
+ */
+#    define SURFACE_DIRTY_RECT_MERGE_COST 64
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -29,24 +29,93 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
-    }
-    if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+static uint32_t rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (rect->b - rect->t + 1);
+}
+
+static surface_dirty_rect_t rect_union(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (surface_dirty_rect_t){
+        .l = QP_MIN(a->l, b->l),
+        .t = QP_MIN(a->t, b->t),
+        .r = QP_MAX(a->r, b->r),
+        .b = QP_MAX(a->b, b->b),
+    };
+}
+
+// Number of extra pixels transferred if both rectangles are sent as their bounding box instead
+static int32_t merge_cost(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    surface_dirty_rect_t merged = rect_union(a, b);
+    return (int32_t)rect_area(&merged) - (int32_t)rect_area(a) - (int32_t)rect_area(b);
+}
+
+// Merges rectangle `from` into `into`, returning the new index of `into`
+static uint8_t merge_rects(surface_dirty_data_t *dirty, uint8_t into, uint8_t from) {
+    dirty->rects[into] = rect_union(&dirty->rects[into], &dirty->rects[from]);
+
+    // Fill the gap with the last rectangle
+    dirty->rects[from] = dirty->rects[--dirty->count];
+    return (into == dirty->count) ? from : into;
+}
+
+// Merges any rectangles that are cheap to combine with the one that just grew
+static uint8_t coalesce_rect(surface_dirty_data_t *dirty, uint8_t index) {
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        if (i != index && merge_cost(&dirty->rects[index], &dirty->rects[i]) <= SURFACE_DIRTY_RECT_MERGE_COST) {
+            index = merge_rects(dirty, index, i);
+            i     = UINT8_MAX; // The rectangle grew again, so restart
+        }
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+    return index;
+}
+
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    surface_dirty_rect_t pixel = {.l = x, .t = y, .r = x, .b = y};
+
+    // Streamed pixels almost always land in, or right next to, the rectangle which took the previous one
+    for (uint8_t n = 0; n < dirty->count; ++n) {
+        uint8_t               i    = (dirty->last + n) % dirty->count;
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (x + 1 >= rect->l && x <= rect->r + 1 && y + 1 >= rect->t && y <= rect->b + 1) {
+            if (x < rect->l || x > rect->r || y < rect->t || y > rect->b) {
+                *rect = rect_union(rect, &pixel);
+                i     = coalesce_rect(dirty, i);
+            }
+            dirty->last = i;
+            return;
+        }
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+
+    if (dirty->count == SURFACE_DIRTY_RECT_COUNT) {
+        // Out of rectangles, either grow the cheapest one to cover the pixel or merge the cheapest pair to free one up
+        uint8_t best_a = 0, best_b = 0;
+        int32_t best_cost = INT32_MAX;
+        for (uint8_t a = 0; a < dirty->count; ++a) {
+            int32_t cost = merge_cost(&dirty->rects[a], &pixel);
+            if (cost < best_cost) {
+                best_a    = a;
+                best_b    = a;
+                best_cost = cost;
+            }
+            for (uint8_t b = a + 1; b < dirty->count; ++b) {
+                cost = merge_cost(&dirty->rects[a], &dirty->rects[b]);
+                if (cost < best_cost) {
+                    best_a    = a;
+                    best_b    = b;
+                    best_cost = cost;
+                }
+            }
+        }
+
+        if (best_a == best_b) {
+            dirty->rects[best_a] = rect_union(&dirty->rects[best_a], &pixel);
+            dirty->last          = coalesce_rect(dirty, best_a);
+            return;
+        }
+        merge_rects(dirty, best_a, best_b);
     }
+
+    dirty->last                 = dirty->count;
+    dirty->rects[dirty->count++] = pixel;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +126,9 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.rects[0] = (surface_dirty_rect_t){.l = 0, .t = 0, .r = surface->base.panel_width - 1, .b = surface->base.panel_height - 1};
+    surface->dirty.count    = 1;
+    surface->dirty.last     = 0;
 
     return true;
 }
@@ -80,9 +147,8 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    surface->dirty.count = 0;
+    surface->dirty.last  = 0;
     return true;
 }
 
@@ -111,7 +177,7 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     painter_driver_t *        target_driver  = (painter_driver_t *)target;
 
     // If we're not dirty... we're done.
-    if (!surface_handle->dirty.is_dirty) {
+    if (!surface_handle->dirty.count) {
         qp_dprintf("qp_surface_draw: ok (not dirty, skipping)\n");
         return true;
     }
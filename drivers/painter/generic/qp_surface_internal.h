@@ -16,12 +16,17 @@ typedef struct surface_painter_driver_vtable_t {
     bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
 } surface_painter_driver_vtable_t;
 
-typedef struct surface_dirty_data_t {
-    bool     is_dirty;
+typedef struct surface_dirty_rect_t {
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+} surface_dirty_rect_t;
+
+typedef struct surface_dirty_data_t {
+    uint8_t              count;
+    uint8_t              last; // Rectangle that took the previous pixel, checked first
+    surface_dirty_rect_t rects[SURFACE_DIRTY_RECT_COUNT];
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -50,7 +55,7 @@ typedef struct surface_painter_device_t {
     // Manually manage the viewport for streaming pixel data to the display
     surface_viewport_data_t viewport;
 
-    // Maintain a dirty region so we can stream only what we need
+    // Maintain the dirty regions so we can stream only what we need
     surface_dirty_data_t dirty;
 } surface_painter_device_t;
 
@@ -76,14 +76,14 @@ bool qp_ld7032_clear(painter_device_t device) {
 // Flush helpers
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void ld7032_flush_0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer, bool inverted) {
+void ld7032_flush_0(painter_device_t device, const surface_dirty_rect_t *rect, const uint8_t *framebuffer, bool inverted) {
     painter_driver_t *                  driver       = (painter_driver_t *)device;
     ld7032_comms_with_command_vtable_t *comms_vtable = (ld7032_comms_with_command_vtable_t *)driver->comms_vtable;
 
-    int     x_start       = dirty->l >> 3;
-    int     x_end         = dirty->r >> 3;
-    int     y_start       = dirty->t;
-    int     y_end         = dirty->b;
+    int     x_start       = rect->l >> 3;
+    int     x_end         = rect->r >> 3;
+    int     y_start       = rect->t;
+    int     y_end         = rect->b;
     int     x_length      = (x_end - x_start) + 1;
     uint8_t x_view_offset = driver->offset_x >> 3;
     uint8_t y_view_offset = driver->offset_y;
@@ -108,14 +108,14 @@ void ld7032_flush_0(painter_device_t device, surface_dirty_data_t *dirty, const
     }
 }
 
-void ld7032_flush_90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer, bool inverted) {
+void ld7032_flush_90(painter_device_t device, const surface_dirty_rect_t *rect, const uint8_t *framebuffer, bool inverted) {
     painter_driver_t *                  driver       = (painter_driver_t *)device;
     ld7032_comms_with_command_vtable_t *comms_vtable = (ld7032_comms_with_command_vtable_t *)driver->comms_vtable;
 
-    int     x_start       = dirty->t >> 3;
-    int     x_end         = dirty->b >> 3;
-    int     y_start       = dirty->l;
-    int     y_end         = dirty->r;
+    int     x_start       = rect->t >> 3;
+    int     x_end         = rect->b >> 3;
+    int     y_start       = rect->l;
+    int     y_end         = rect->r;
     int     x_length      = (x_end - x_start) + 1;
     uint8_t x_view_offset = driver->offset_x >> 3;
     uint8_t y_view_offset = driver->offset_y;
@@ -256,24 +256,28 @@ __attribute__((weak)) bool qp_ld7032_init(painter_device_t device, painter_rotat
 bool qp_ld7032_flush(painter_device_t device) {
     ld7032_device_t *driver = (ld7032_device_t *)device;
 
-    if (!driver->oled.surface.dirty.is_dirty) {
+    if (!driver->oled.surface.dirty.count) {
         return true;
     }
 
-    switch (driver->oled.base.rotation) {
-        default:
-        case QP_ROTATION_0:
-            ld7032_flush_0(device, &driver->oled.surface.dirty, driver->framebuffer, false);
-            break;
-        case QP_ROTATION_180:
-            ld7032_flush_0(device, &driver->oled.surface.dirty, driver->framebuffer, true);
-            break;
-        case QP_ROTATION_90:
-            ld7032_flush_90(device, &driver->oled.surface.dirty, driver->framebuffer, false);
-            break;
-        case QP_ROTATION_270:
-            ld7032_flush_90(device, &driver->oled.surface.dirty, driver->framebuffer, true);
-            break;
+    // Each dirty rectangle is sent on its own
+    for (uint8_t i = 0; i < driver->oled.surface.dirty.count; ++i) {
+        const surface_dirty_rect_t *rect = &driver->oled.surface.dirty.rects[i];
+        switch (driver->oled.base.rotation) {
+            default:
+            case QP_ROTATION_0:
+                ld7032_flush_0(device, rect, driver->framebuffer, false);
+                break;
+            case QP_ROTATION_180:
+                ld7032_flush_0(device, rect, driver->framebuffer, true);
+                break;
+            case QP_ROTATION_90:
+                ld7032_flush_90(device, rect, driver->framebuffer, false);
+                break;
+            case QP_ROTATION_270:
+                ld7032_flush_90(device, rect, driver->framebuffer, true);
+                break;
+        }
     }
 
     // Clear the dirty area
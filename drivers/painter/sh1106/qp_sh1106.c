@@ -79,24 +79,28 @@ __attribute__((weak)) bool qp_sh1106_init(painter_device_t device, painter_rotat
 bool qp_sh1106_flush(painter_device_t device) {
     sh1106_device_t *driver = (sh1106_device_t *)device;
 
-    if (!driver->oled.surface.dirty.is_dirty) {
+    if (!driver->oled.surface.dirty.count) {
         return true;
     }
 
-    switch (driver->oled.base.rotation) {
-        default:
-        case QP_ROTATION_0:
-            qp_oled_panel_page_column_flush_rot0(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_90:
-            qp_oled_panel_page_column_flush_rot90(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_180:
-            qp_oled_panel_page_column_flush_rot180(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_270:
-            qp_oled_panel_page_column_flush_rot270(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
+    // Each dirty rectangle is sent on its own
+    for (uint8_t i = 0; i < driver->oled.surface.dirty.count; ++i) {
+        const surface_dirty_rect_t *rect = &driver->oled.surface.dirty.rects[i];
+        switch (driver->oled.base.rotation) {
+            default:
+            case QP_ROTATION_0:
+                qp_oled_panel_page_column_flush_rot0(device, rect, driver->framebuffer);
+                break;
+            case QP_ROTATION_90:
+                qp_oled_panel_page_column_flush_rot90(device, rect, driver->framebuffer);
+                break;
+            case QP_ROTATION_180:
+                qp_oled_panel_page_column_flush_rot180(device, rect, driver->framebuffer);
+                break;
+            case QP_ROTATION_270:
+                qp_oled_panel_page_column_flush_rot270(device, rect, driver->framebuffer);
+                break;
+        }
     }
 
     // Clear the dirty area
@@ -28,6 +28,15 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#ifdef SERIAL_USART_SLAVE_PUSH
+// target sends a transaction's target2initiator buffer unsolicited
+bool soft_serial_target_push(int sstd_index);
+// initiator checks whether a pushed buffer arrived since the last call
+bool soft_serial_initiator_pushed(int sstd_index);
+// initiator checks whether a push was dropped since the last call
+bool soft_serial_initiator_push_failed(void);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
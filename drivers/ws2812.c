@@ -1,6 +1,7 @@
 // Copyright 2024 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "ws2812.h"
 
 #if defined(WS2812_RGBW)
@@ -13,3 +14,17 @@ void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
     led->b -= led->w;
 }
 #endif
+
+bool ws2812_update_led(ws2812_led_t *led, uint8_t red, uint8_t green, uint8_t blue) {
+    ws2812_led_t color = {.r = red, .g = green, .b = blue};
+#if defined(WS2812_RGBW)
+    ws2812_rgb_to_rgbw(&color);
+#endif
+
+    if (memcmp(led, &color, sizeof(ws2812_led_t)) == 0) {
+        return false;
+    }
+
+    *led = color;
+    return true;
+}
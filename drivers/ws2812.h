@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
 #include "util.h"
 
 /*
@@ -95,3 +97,11 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
+
+/**
+ * Store a color in a driver's LED buffer, converting it to RGBW if needed.
+ *
+ * Returns true if the LED changed, so that drivers which keep an encoded copy
+ * of the frame only need to re-encode the LEDs that were actually touched.
+ */
+bool ws2812_update_led(ws2812_led_t *led, uint8_t red, uint8_t green, uint8_t blue);
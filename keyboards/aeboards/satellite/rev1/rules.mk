@@ -2,5 +2,6 @@ COMMON_VPATH += $(DRIVER_PATH)/issi
 
 # project specific files
 SRC +=  drivers/led/issi/is31fl3731.c
+SRC +=  drivers/led/issi/is31_common.c
 
 I2C_DRIVER_REQUIRED = yes
@@ -1,4 +1,5 @@
 # project specific files
 SRC += indicators.c \
-       drivers/led/issi/is31fl3731-mono.c
+       drivers/led/issi/is31fl3731-mono.c \
+       drivers/led/issi/is31_common.c
 I2C_DRIVER_REQUIRED = yes
@@ -1,3 +1,4 @@
 QUANTUM_LIB_SRC += drivers/led/issi/is31fl3731.c
+QUANTUM_LIB_SRC += drivers/led/issi/is31_common.c
 WS2812_DRIVER_REQUIRED = yes
 I2C_DRIVER_REQUIRED = yes
@@ -5,4 +5,5 @@ I2C_DRIVER_REQUIRED = yes
 SRC += keyboards/wilba_tech/wt_main.c \
        keyboards/wilba_tech/wt_rgb_backlight.c \
        quantum/color.c \
-       drivers/led/issi/is31fl3731.c
+       drivers/led/issi/is31fl3731.c \
+       drivers/led/issi/is31_common.c
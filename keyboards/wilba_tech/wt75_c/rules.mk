@@ -2,6 +2,7 @@ I2C_DRIVER_REQUIRED = yes
 
 # project specific files
 SRC =	drivers/led/issi/is31fl3736-mono.c \
+		drivers/led/issi/is31_common.c \
 		quantum/color.c \
 		keyboards/wilba_tech/wt_mono_backlight.c \
 		keyboards/wilba_tech/wt_main.c
@@ -9,3 +9,4 @@ WS2812_DRIVER_REQUIRED = yes
 # project specific files
 COMMON_VPATH += $(DRIVER_PATH)/issi
 SRC +=  drivers/led/issi/is31fl3731.c
+SRC +=  drivers/led/issi/is31_common.c
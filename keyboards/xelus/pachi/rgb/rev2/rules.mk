@@ -1,4 +1,5 @@
 COMMON_VPATH += $(DRIVER_PATH)/issi
 SRC += drivers/led/issi/is31fl3741.c
+SRC += drivers/led/issi/is31_common.c
 
 OPT = 2
@@ -81,6 +81,7 @@ subcommands = [
     'qmk.cli.new.keyboard',
     'qmk.cli.new.keymap',
     'qmk.cli.painter',
+    'qmk.cli.profiler',
     'qmk.cli.pytest',
     'qmk.cli.test.c',
     'qmk.cli.userspace.add',
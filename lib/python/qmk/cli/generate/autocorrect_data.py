@@ -49,6 +49,15 @@ TYPO_CHARS = dict([
 ] + [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'),
                                                   ord('z') + 1)])  # Characters a-z.
 
+# Keycodes in the order of the child bitmap of indexed branch nodes.
+TYPO_SYMBOLS = [c + KC_A - ord('a') for c in range(ord('a'), ord('z') + 1)] + [KC_SPC, KC_QUOT]
+
+# Longest chain of single-child nodes in one indexed chain node.
+CHAIN_MAX = 63
+
+# Branch nodes with up to this many children list them instead of using a bitmap.
+SHORT_BRANCH_MAX = 3
+
 
 def parse_file(file_name: str) -> List[Tuple[str, str]]:
     """Parses autocorrections dictionary file.
@@ -232,6 +241,108 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def serialize_indexed_trie(trie: Dict[str, Any]) -> Tuple[List[int], int]:
+    """Serializes trie and correction data in the indexed format readable by the C code.
+  Branch nodes with more than SHORT_BRANCH_MAX children carry a bitmap of their
+  children, so the C code finds a child with a popcount instead of searching the
+  siblings. Identical subtrees are only serialized once.
+  Args:
+    trie: Dict of dicts.
+  Returns:
+    Tuple of the list of ints in the range 0-255 and the link size in bytes.
+  """
+    nodes = []  # Unique nodes, each a (kind, data, children) tuple.
+    node_ids = {}
+
+    def intern(node: Tuple[str, Tuple, Tuple]) -> int:
+        if node not in node_ids:
+            node_ids[node] = len(nodes)
+            nodes.append(node)
+        return node_ids[node]
+
+    # Build the nodes bottom up, so identical subtrees get the same id.
+    def build(trie_node) -> int:
+        if 'LEAF' in trie_node:  # Handle a leaf trie node.
+            typo, correction = trie_node['LEAF']
+            word_boundary_ending = typo[-1] == ':'
+            typo = typo.strip(':')
+            i = 0
+            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+                i += 1
+            backspaces = len(typo) - i - 1 + word_boundary_ending
+            assert 0 <= backspaces <= 63
+            return intern(('leaf', tuple([backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]), ()))
+
+        if len(trie_node) == 1:  # Handle a chain of single-child nodes.
+            chars = ''
+            while len(trie_node) == 1 and 'LEAF' not in trie_node:
+                c, trie_node = next(iter(trie_node.items()))
+                chars += c
+            child = build(trie_node)
+            # Chains are split so the length fits in the node header.
+            for start in reversed(range(0, len(chars), CHAIN_MAX)):
+                child = intern(('chain', tuple(TYPO_CHARS[c] for c in chars[start:start + CHAIN_MAX]), (child, )))
+            return child
+
+        chars = sorted(trie_node.keys(), key=lambda c: TYPO_CHARS[c])
+        return intern(('branch', tuple(TYPO_CHARS[c] for c in chars), tuple(build(trie_node[c]) for c in chars)))
+
+    root = build(trie)
+
+    # Lay the nodes out depth first from the root at offset 0. The child of a
+    # chain follows it directly unless it was already placed elsewhere.
+    order = []
+    inline = set()
+    placed = set()
+
+    def place(node_id: int) -> None:
+        placed.add(node_id)
+        order.append(node_id)
+        kind, _, children = nodes[node_id]
+        if kind == 'chain' and children[0] not in placed:
+            inline.add(node_id)
+        for child in children:
+            if child not in placed:
+                place(child)
+
+    place(root)
+
+    def serialize(node_id: int, offsets: Dict[int, int], link_size: int) -> List[int]:
+        kind, data, children = nodes[node_id]
+
+        def link(child: int) -> List[int]:
+            return list(offsets.get(child, 0).to_bytes(link_size, 'little'))
+
+        if kind == 'leaf':
+            return list(data)
+        elif kind == 'chain':
+            if node_id in inline:
+                return [len(data)] + list(data)
+            return [192 | len(data)] + list(data) + link(children[0])
+        elif len(data) <= SHORT_BRANCH_MAX:
+            return [64 | len(data)] + [b for c, child in zip(data, children) for b in [c] + link(child)]
+        else:
+            bitmap = sum(1 << TYPO_SYMBOLS.index(c) for c in data)
+            return [64] + list(bitmap.to_bytes(4, 'little')) + [b for child in children for b in link(child)]
+
+    for link_size in (2, 3):
+        offsets = {}
+        byte_offset = 0
+        for node_id in order:  # To encode links, first compute byte offset of each node.
+            offsets[node_id] = byte_offset
+            byte_offset += len(serialize(node_id, {}, link_size))
+        if byte_offset < 1 << (8 * link_size):
+            break
+    else:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, it exceeds the 16MB limit. Try reducing the autocorrection dict to fewer entries.')
+        maybe_exit(1)
+
+    # Inline children must directly follow their chain.
+    assert all(offsets[nodes[n][2][0]] == offsets[n] + 1 + len(nodes[n][1]) for n in inline)
+
+    return [b for node_id in order for b in serialize(node_id, offsets, link_size)], link_size
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -254,11 +365,15 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('--legacy', arg_only=True, action='store_true', help="Use the original trie format, which older versions of QMK can read")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.legacy:
+        data = serialize_trie(autocorrections, trie)
+    else:
+        data, link_size = serialize_indexed_trie(trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -281,6 +396,9 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
+    if not cli.args.legacy:
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_TRIE_FORMAT 2')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_LINK_SIZE {link_size}')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
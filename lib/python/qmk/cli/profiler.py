@@ -0,0 +1,127 @@
+"""Read scan loop timing statistics from a keyboard built with SCAN_PROFILER_ENABLE.
+"""
+import json
+
+from milc import cli
+
+RAW_USAGE_PAGE = 0xFF60
+RAW_USAGE_ID = 0x61
+RAW_EPSIZE = 32
+
+SCAN_PROFILER_RAW_HID_ID = 0xFD
+CMD_GET_INFO = 0x01
+CMD_GET_STATS = 0x02
+CMD_GET_HISTOGRAM = 0x03
+CMD_GET_NAME = 0x04
+CMD_RESET = 0x05
+CMD_ERROR = 0xFF
+
+
+def _u32(data, offset):
+    return int.from_bytes(bytes(data[offset:offset + 4]), 'big')
+
+
+def _find_device(vid, pid):
+    """Locate the raw HID interface of the first matching keyboard.
+    """
+    import hid
+
+    for dev in hid.enumerate(vid or 0, pid or 0):
+        if dev['usage_page'] == RAW_USAGE_PAGE and dev['usage'] == RAW_USAGE_ID:
+            return hid.Device(path=dev['path'])
+
+    return None
+
+
+def _query(device, command, stage=0, arg=0):
+    packet = [SCAN_PROFILER_RAW_HID_ID, command, stage, arg] + [0] * (RAW_EPSIZE - 4)
+    device.write(bytes([0x00] + packet))
+    reply = device.read(RAW_EPSIZE, 1000)
+
+    if len(reply) < 4 or reply[0] != SCAN_PROFILER_RAW_HID_ID:
+        raise RuntimeError('Keyboard did not answer the profiler query; is SCAN_PROFILER_ENABLE set?')
+    if reply[1] == CMD_ERROR:
+        raise RuntimeError(f'Keyboard rejected profiler command {command:#04x}')
+
+    return reply
+
+
+def _read_stage(device, stage, buckets):
+    name = bytes(_query(device, CMD_GET_NAME, stage)[3:]).split(b'\0', 1)[0].decode('ascii')
+    stats = _query(device, CMD_GET_STATS, stage)
+
+    histogram = []
+    while len(histogram) < buckets:
+        reply = _query(device, CMD_GET_HISTOGRAM, stage, len(histogram))
+        chunk = reply[4:]
+        for i in range(0, len(chunk) - 1, 2):
+            if len(histogram) == buckets:
+                break
+            histogram.append((chunk[i] << 8) | chunk[i + 1])
+
+    return {
+        'name': name,
+        'count': _u32(stats, 3),
+        'min': _u32(stats, 7),
+        'max': _u32(stats, 11),
+        'p50': _u32(stats, 15),
+        'p99': _u32(stats, 19),
+        'mean': _u32(stats, 23),
+        'histogram': histogram,
+    }
+
+
+def _format_ticks(ticks, ticks_per_ms):
+    if not ticks_per_ms:
+        return str(ticks)
+
+    return f'{ticks * 1000 / ticks_per_ms:.1f}us'
+
+
+@cli.argument('-d', '--device', help='Device to select as VID:PID, eg. 0x03A8:0x0068. Defaults to the first raw HID capable keyboard.')
+@cli.argument('-r', '--reset', arg_only=True, action='store_true', help='Clear the collected samples after reading them.')
+@cli.argument('-a', '--all', arg_only=True, action='store_true', help='Also list stages with no samples.')
+@cli.argument('-j', '--json', arg_only=True, action='store_true', help='Output the raw statistics as JSON.')
+@cli.subcommand('Read scan loop timings from a keyboard built with SCAN_PROFILER_ENABLE.', hidden=False if cli.config.user.developer else True)
+def profiler(cli):
+    """Query the scan profiler over raw HID and print per stage timings.
+    """
+    vid = pid = None
+    if cli.config.profiler.device:
+        try:
+            vid, pid = (int(part, 0) for part in cli.config.profiler.device.split(':'))
+        except ValueError:
+            cli.log.error('Invalid device %s, expected VID:PID', cli.config.profiler.device)
+            return False
+
+    device = _find_device(vid, pid)
+    if not device:
+        cli.log.error('No raw HID device found.')
+        return False
+
+    try:
+        info = _query(device, CMD_GET_INFO)
+        stage_count, buckets, ticks_per_ms = info[4], info[5], _u32(info, 6)
+        stages = [_read_stage(device, stage, buckets) for stage in range(stage_count)]
+
+        if cli.args.reset:
+            _query(device, CMD_RESET)
+    except RuntimeError as e:
+        cli.log.error(str(e))
+        return False
+    finally:
+        device.close()
+
+    if not cli.args.all:
+        stages = [stage for stage in stages if stage['count']]
+
+    if cli.args.json:
+        print(json.dumps({'ticks_per_ms': ticks_per_ms, 'stages': stages}, indent=2))
+        return True
+
+    cli.echo('{fg_cyan}%-16s %10s %10s %10s %10s %10s %10s', 'stage', 'count', 'min', 'p50', 'p99', 'max', 'mean')
+    for stage in stages:
+        values = [_format_ticks(stage[key], ticks_per_ms) for key in ('min', 'p50', 'p99', 'max', 'mean')]
+        cli.echo('%-16s %10d %10s %10s %10s %10s %10s', stage['name'], stage['count'], *values)
+
+    return True
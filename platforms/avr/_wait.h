@@ -43,6 +43,7 @@
 
 #define wait_ms(ms)                             \
     do {                                        \
+        wait_ms_flush_reports();                \
         if (__builtin_constant_p(ms)) {         \
             _delay_ms(ms);                      \
         } else {                                \
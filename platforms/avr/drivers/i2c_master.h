@@ -19,6 +19,10 @@
 
 #pragma once
 
+#ifdef I2C_ASYNC_ENABLE
+#    error "I2C_ASYNC_ENABLE is only supported on ChibiOS"
+#endif
+
 #include <stdint.h>
 
 // ### DEPRECATED - DO NOT USE ###
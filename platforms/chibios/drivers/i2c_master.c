@@ -129,6 +129,180 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
+/**
+ * @brief Performs the transfer described by a transaction on the bus.
+ *
+ * @param transaction the transfer to perform
+ * @return i2c_status_t QMK specific I2C status code
+ */
+static i2c_status_t i2c_execute(i2c_transaction_t* transaction) {
+    i2cStart(&I2C_DRIVER, &i2cconfig);
+
+    const i2caddr_t     address = transaction->address >> 1;
+    const sysinterval_t timeout = TIME_MS2I(transaction->timeout);
+
+    if (transaction->reg_length == 0 && transaction->tx_length == 0) {
+        return i2c_epilogue(i2cMasterReceiveTimeout(&I2C_DRIVER, address, transaction->rx_data, transaction->rx_length, timeout));
+    }
+
+    if (transaction->reg_length == 0 || transaction->tx_length == 0) {
+        const uint8_t* tx_data   = transaction->reg_length ? transaction->reg : transaction->tx_data;
+        size_t         tx_length = transaction->reg_length ? transaction->reg_length : transaction->tx_length;
+        return i2c_epilogue(i2cMasterTransmitTimeout(&I2C_DRIVER, address, tx_data, tx_length, transaction->rx_data, transaction->rx_length, timeout));
+    }
+
+    // Register writes need the register address and the data in a single buffer
+    size_t packet_length = transaction->reg_length + transaction->tx_length;
+#ifdef I2C_ASYNC_ENABLE
+    // Only ever used from the worker thread, and kept off its stack. Blocking calls build their packet beforehand,
+    // so only queued register writes are limited in size.
+    static uint8_t packet[I2C_ASYNC_BUFFER_SIZE];
+    if (packet_length > sizeof(packet)) {
+        return I2C_STATUS_ERROR;
+    }
+#else
+    uint8_t packet[packet_length];
+#endif
+    memcpy(packet, transaction->reg, transaction->reg_length);
+    memcpy(packet + transaction->reg_length, transaction->tx_data, transaction->tx_length);
+
+    return i2c_epilogue(i2cMasterTransmitTimeout(&I2C_DRIVER, address, packet, packet_length, transaction->rx_data, transaction->rx_length, timeout));
+}
+
+#ifdef I2C_ASYNC_ENABLE
+// Pending transactions, run in order by the worker thread
+static i2c_transaction_t* queue_head = NULL;
+static i2c_transaction_t* queue_tail = NULL;
+static semaphore_t        queue_pending;
+
+// Completed transactions that still have to have their callback invoked
+static i2c_transaction_t* completed_head = NULL;
+static i2c_transaction_t* completed_tail = NULL;
+
+// Signalled every time a transaction completes
+static binary_semaphore_t transaction_completed;
+
+static THD_WORKING_AREA(waI2CThread, I2C_ASYNC_THREAD_STACK_SIZE);
+static THD_FUNCTION(I2CThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_master");
+
+    while (true) {
+        chSemWait(&queue_pending);
+
+        chSysLock();
+        i2c_transaction_t* transaction = queue_head;
+        queue_head                     = transaction->next;
+        if (queue_head == NULL) {
+            queue_tail = NULL;
+        }
+        chSysUnlock();
+
+        i2c_status_t status = i2c_execute(transaction);
+
+        chSysLock();
+        transaction->status = status;
+        transaction->state  = I2C_TRANSACTION_COMPLETE;
+        transaction->next   = NULL;
+        if (transaction->callback) {
+            transaction->callback_pending = true;
+            if (completed_tail) {
+                completed_tail->next = transaction;
+            } else {
+                completed_head = transaction;
+            }
+            completed_tail = transaction;
+        }
+        chBSemSignalI(&transaction_completed);
+        chSchRescheduleS();
+        chSysUnlock();
+    }
+}
+
+// Not part of i2c_init(), as keyboards may replace that with their own pin setup
+static void i2c_async_init(void) {
+    static bool is_initialised = false;
+    if (!is_initialised) {
+        is_initialised = true;
+
+        chSemObjectInit(&queue_pending, 0);
+        chBSemObjectInit(&transaction_completed, true);
+        // Above the main loop, so that a transfer starts as soon as it is queued
+        chThdCreateStatic(waI2CThread, sizeof(waI2CThread), NORMALPRIO + 1, I2CThread, NULL);
+    }
+}
+
+bool i2c_transaction_submit_chain(i2c_transaction_t* transactions, uint8_t count) {
+    if (count == 0) {
+        return true;
+    }
+
+    i2c_async_init();
+
+    chSysLock();
+    for (uint8_t i = 0; i < count; i++) {
+        if (transactions[i].state == I2C_TRANSACTION_QUEUED || transactions[i].callback_pending) {
+            chSysUnlock();
+            return false;
+        }
+    }
+
+    // Link the whole chain in at once so nothing else can be queued in between
+    for (uint8_t i = 0; i < count; i++) {
+        i2c_transaction_t* transaction = &transactions[i];
+        transaction->state             = I2C_TRANSACTION_QUEUED;
+        transaction->status            = I2C_STATUS_SUCCESS;
+        transaction->next              = NULL;
+        if (queue_tail) {
+            queue_tail->next = transaction;
+        } else {
+            queue_head = transaction;
+        }
+        queue_tail = transaction;
+        chSemSignalI(&queue_pending);
+    }
+    chSchRescheduleS();
+    chSysUnlock();
+    return true;
+}
+
+bool i2c_transaction_submit(i2c_transaction_t* transaction) {
+    return i2c_transaction_submit_chain(transaction, 1);
+}
+
+bool i2c_transaction_is_complete(const i2c_transaction_t* transaction) {
+    return transaction->state != I2C_TRANSACTION_QUEUED;
+}
+
+i2c_status_t i2c_transaction_wait(i2c_transaction_t* transaction) {
+    while (!i2c_transaction_is_complete(transaction)) {
+        chBSemWait(&transaction_completed);
+    }
+    return transaction->status;
+}
+
+void i2c_async_task(void) {
+    while (true) {
+        chSysLock();
+        i2c_transaction_t* transaction = completed_head;
+        if (transaction) {
+            completed_head = transaction->next;
+            if (completed_head == NULL) {
+                completed_tail = NULL;
+            }
+        }
+        chSysUnlock();
+
+        if (!transaction) {
+            break;
+        }
+        // The callback is free to submit the transaction again
+        transaction->callback_pending = false;
+        transaction->callback(transaction);
+    }
+}
+#endif // I2C_ASYNC_ENABLE
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -149,56 +323,101 @@ __attribute__((weak)) void i2c_init(void) {
     }
 }
 
-i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+void i2c_transaction_transmit(i2c_transaction_t* transaction, uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    *transaction = (i2c_transaction_t){
+        .address   = address,
+        .tx_data   = data,
+        .tx_length = length,
+        .timeout   = timeout,
+    };
 }
 
-i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+void i2c_transaction_receive(i2c_transaction_t* transaction, uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    *transaction = (i2c_transaction_t){
+        .address   = address,
+        .rx_data   = data,
+        .rx_length = length,
+        .timeout   = timeout,
+    };
 }
 
-i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+void i2c_transaction_write_register(i2c_transaction_t* transaction, uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_transaction_transmit(transaction, devaddr, data, length, timeout);
+    transaction->reg[0]     = regaddr;
+    transaction->reg_length = 1;
+}
 
-    uint8_t complete_packet[length + 1];
-    for (uint16_t i = 0; i < length; i++) {
-        complete_packet[i + 1] = data[i];
+void i2c_transaction_read_register(i2c_transaction_t* transaction, uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_transaction_receive(transaction, devaddr, data, length, timeout);
+    transaction->reg[0]     = regaddr;
+    transaction->reg_length = 1;
+}
+
+i2c_status_t i2c_transaction_run(i2c_transaction_t* transaction) {
+#ifdef I2C_ASYNC_ENABLE
+    if (transaction->reg_length && transaction->tx_length) {
+        // Build register writes on the caller's stack, as the worker's buffer is limited in size
+        uint8_t packet[transaction->reg_length + transaction->tx_length];
+        memcpy(packet, transaction->reg, transaction->reg_length);
+        memcpy(packet + transaction->reg_length, transaction->tx_data, transaction->tx_length);
+
+        i2c_transaction_t packet_transaction;
+        i2c_transaction_transmit(&packet_transaction, transaction->address, packet, sizeof(packet), transaction->timeout);
+        packet_transaction.rx_data   = transaction->rx_data;
+        packet_transaction.rx_length = transaction->rx_length;
+        transaction->status          = i2c_transaction_run(&packet_transaction);
+        return transaction->status;
     }
-    complete_packet[0] = regaddr;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    if (!i2c_transaction_submit(transaction)) {
+        return I2C_STATUS_ERROR;
+    }
+    return i2c_transaction_wait(transaction);
+#else
+    return i2c_execute(transaction);
+#endif
 }
 
-i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_transaction_t transaction;
+    i2c_transaction_transmit(&transaction, address, data, length, timeout);
+    return i2c_transaction_run(&transaction);
+}
 
-    uint8_t complete_packet[length + 2];
-    for (uint16_t i = 0; i < length; i++) {
-        complete_packet[i + 2] = data[i];
-    }
-    complete_packet[0] = regaddr >> 8;
-    complete_packet[1] = regaddr & 0xFF;
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_transaction_t transaction;
+    i2c_transaction_receive(&transaction, address, data, length, timeout);
+    return i2c_transaction_run(&transaction);
+}
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_transaction_t transaction;
+    i2c_transaction_write_register(&transaction, devaddr, regaddr, data, length, timeout);
+    return i2c_transaction_run(&transaction);
+}
+
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_transaction_t transaction;
+    i2c_transaction_transmit(&transaction, devaddr, data, length, timeout);
+    transaction.reg[0]     = regaddr >> 8;
+    transaction.reg[1]     = regaddr & 0xFF;
+    transaction.reg_length = 2;
+    return i2c_transaction_run(&transaction);
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_transaction_t transaction;
+    i2c_transaction_read_register(&transaction, devaddr, regaddr, data, length, timeout);
+    return i2c_transaction_run(&transaction);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
-    msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_transaction_t transaction;
+    i2c_transaction_receive(&transaction, devaddr, data, length, timeout);
+    transaction.reg[0]     = regaddr >> 8;
+    transaction.reg[1]     = regaddr & 0xFF;
+    transaction.reg_length = 2;
+    return i2c_transaction_run(&transaction);
 }
 
 __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
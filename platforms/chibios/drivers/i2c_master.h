@@ -25,6 +25,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 // ### DEPRECATED - DO NOT USE ###
 #define i2c_writeReg(devaddr, regaddr, data, length, timeout) i2c_write_register(devaddr, regaddr, data, length, timeout)
@@ -39,6 +40,99 @@ typedef int16_t i2c_status_t;
 #define I2C_STATUS_ERROR (-1)
 #define I2C_STATUS_TIMEOUT (-2)
 
+#ifndef I2C_ASYNC_BUFFER_SIZE
+#    define I2C_ASYNC_BUFFER_SIZE 64
+#endif
+
+#ifndef I2C_ASYNC_THREAD_STACK_SIZE
+#    define I2C_ASYNC_THREAD_STACK_SIZE 256
+#endif
+
+/**
+ * @brief A single I2C transfer, owned by the caller.
+ *
+ * Fill it in with one of the i2c_transaction_*() helpers, then either run it
+ * right away with i2c_transaction_run(), or hand it to the background queue
+ * with i2c_transaction_submit() when I2C_ASYNC_ENABLE is defined. A queued
+ * transaction must stay valid until it has completed.
+ */
+typedef struct i2c_transaction_t i2c_transaction_t;
+
+/**
+ * @brief Called from i2c_async_task() once a queued transaction has completed.
+ */
+typedef void (*i2c_transaction_callback_t)(i2c_transaction_t* transaction);
+
+typedef enum {
+    I2C_TRANSACTION_IDLE,
+    I2C_TRANSACTION_QUEUED,
+    I2C_TRANSACTION_COMPLETE,
+} i2c_transaction_state_t;
+
+struct i2c_transaction_t {
+    uint8_t                    address;
+    uint8_t                    reg[2];
+    uint8_t                    reg_length;
+    const uint8_t*             tx_data;
+    uint16_t                   tx_length;
+    uint8_t*                   rx_data;
+    uint16_t                   rx_length;
+    uint16_t                   timeout;
+    i2c_transaction_callback_t callback;
+    void*                      cb_arg;
+
+    // Managed by the queue
+    i2c_transaction_t* volatile      next;
+    volatile i2c_transaction_state_t state;
+    volatile i2c_status_t            status;
+    volatile bool                    callback_pending;
+};
+
+void i2c_transaction_transmit(i2c_transaction_t* transaction, uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout);
+void i2c_transaction_receive(i2c_transaction_t* transaction, uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout);
+void i2c_transaction_write_register(i2c_transaction_t* transaction, uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+void i2c_transaction_read_register(i2c_transaction_t* transaction, uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
+
+/**
+ * @brief Runs the transaction and waits for it to complete.
+ *
+ * With I2C_ASYNC_ENABLE this goes through the queue, so that it is ordered
+ * with respect to any transactions that are already pending.
+ */
+i2c_status_t i2c_transaction_run(i2c_transaction_t* transaction);
+
+#ifdef I2C_ASYNC_ENABLE
+/**
+ * @brief Queues a transaction to be run in the background.
+ *
+ * @return false if the transaction is still queued from a previous submission
+ */
+bool i2c_transaction_submit(i2c_transaction_t* transaction);
+
+/**
+ * @brief Queues an array of transactions that run back to back, without other
+ * transactions in between, e.g. a page select followed by register writes.
+ *
+ * @return false if any of them is still queued from a previous submission
+ */
+bool i2c_transaction_submit_chain(i2c_transaction_t* transactions, uint8_t count);
+
+/**
+ * @brief Checks whether a submitted transaction has finished, its status is then valid.
+ */
+bool i2c_transaction_is_complete(const i2c_transaction_t* transaction);
+
+/**
+ * @brief Blocks until a submitted transaction has finished.
+ */
+i2c_status_t i2c_transaction_wait(i2c_transaction_t* transaction);
+
+/**
+ * @brief Runs the completion callbacks of finished transactions, called from the main loop.
+ */
+void i2c_async_task(void);
+#endif
+
 void         i2c_init(void);
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout);
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout);
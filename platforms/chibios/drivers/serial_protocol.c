@@ -7,6 +7,25 @@
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 
+#ifdef SERIAL_USART_SLAVE_PUSH
+#    include "crc.h"
+
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error SERIAL_USART_SLAVE_PUSH requires SERIAL_USART_FULL_DUPLEX
+#    endif
+
+/* Starts an unsolicited frame from the slave, never a valid handshake as those are below 2 * NUM_TOTAL_TRANSACTIONS. */
+#    define PUSH_TOKEN 0xA5
+_Static_assert(2 * NUM_TOTAL_TRANSACTIONS <= PUSH_TOKEN, "Handshakes must not be mistaken for the push token");
+
+static uint32_t pushed_transactions = 0;
+/* Set when a push may have been lost, so that the master reads the buffers it relies on pushes for. */
+static bool push_failed = false;
+
+static inline bool receive_push(void);
+static inline void receive_pending_pushes(void);
+#endif // SERIAL_USART_SLAVE_PUSH
+
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
@@ -100,9 +119,18 @@ static inline bool react_to_transaction(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#ifdef SERIAL_USART_SLAVE_PUSH
+    {
+        split_shared_memory_lock_autounlock();
+        /* Collect whatever the slave pushed since the last transaction, this also
+         * clears the receive queue if anything else is found in it. */
+        receive_pending_pushes();
+    }
+#else
     /* Clear the receive queue, to start with a clean slate.
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
+#endif
 
     return initiate_transaction((uint8_t)index);
 }
@@ -133,7 +161,14 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
-    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+    bool shake_received = serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake));
+#ifdef SERIAL_USART_SLAVE_PUSH
+    /* The slave may have started a push just before it saw our handshake, which it then answers right after. */
+    while (shake_received && transaction_id_shake == PUSH_TOKEN) {
+        shake_received = receive_push() && serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake));
+    }
+#endif
+    if (unlikely(!shake_received || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
         serial_dprintf("SPLIT: receiving handshake failed\n");
         return false;
     }
@@ -156,3 +191,113 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#ifdef SERIAL_USART_SLAVE_PUSH
+
+/**
+ * @brief Send the target to initiator buffer of a transaction from the slave
+ * half, without waiting for the master to ask for it.
+ *
+ * @param index Transaction Table index of the buffer to push.
+ * @return bool Indicates success of sending the push.
+ */
+bool soft_serial_target_push(int index) {
+    if (unlikely(index >= NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    /* Holding the lock keeps the push from interleaving with the reply to a transaction. */
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t* transaction = &split_transaction_table[index];
+    uint8_t                   header[2]   = {PUSH_TOKEN, (uint8_t)index};
+    uint8_t                   checksum    = crc8(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+
+    return serial_transport_send(header, sizeof(header)) && serial_transport_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size) && serial_transport_send(&checksum, sizeof(checksum));
+}
+
+/**
+ * @brief Check on the master half whether the slave pushed a transaction
+ * buffer since the last call. The pushed data is in the transaction's target
+ * to initiator buffer.
+ *
+ * @param index Transaction Table index to check.
+ * @return bool Indicates a valid push has been received.
+ */
+bool soft_serial_initiator_pushed(int index) {
+    if (unlikely(index >= NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    receive_pending_pushes();
+
+    bool pushed = pushed_transactions & (1UL << index);
+    pushed_transactions &= ~(1UL << index);
+    return pushed;
+}
+
+/**
+ * @brief Check on the master half whether a push was dropped since the last
+ * call, because it was corrupted or arrived incomplete.
+ *
+ * @return bool Indicates that a push may have been lost.
+ */
+bool soft_serial_initiator_push_failed(void) {
+    split_shared_memory_lock_autounlock();
+
+    receive_pending_pushes();
+
+    bool failed = push_failed;
+    push_failed = false;
+    return failed;
+}
+
+/**
+ * @brief Receive the rest of a push frame, after its token has been read.
+ */
+static inline bool receive_push(void) {
+    uint8_t transaction_id = 0xFF;
+    if (unlikely(!serial_transport_receive(&transaction_id, sizeof(transaction_id)) || transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: receiving push failed\n");
+        push_failed = true;
+        return false;
+    }
+
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+    uint8_t                   checksum    = 0;
+
+    if (unlikely(!serial_transport_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size) || !serial_transport_receive(&checksum, sizeof(checksum)))) {
+        serial_dprintf("SPLIT: receiving push failed\n");
+        push_failed = true;
+        return false;
+    }
+
+    /* A corrupted push is dropped, and the master reads the buffer itself on its next transport run. */
+    if (unlikely(checksum != crc8(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        serial_dprintf("SPLIT: push checksum mismatch\n");
+        push_failed = true;
+        return false;
+    }
+
+    pushed_transactions |= 1UL << transaction_id;
+    return true;
+}
+
+/**
+ * @brief Receive all pushes that are waiting in the receive queue, without blocking.
+ */
+static inline void receive_pending_pushes(void) {
+    uint8_t token = 0;
+    while (serial_transport_receive_nowait(&token, sizeof(token))) {
+        if (unlikely(token != PUSH_TOKEN || !receive_push())) {
+            /* Parts of failed transactions or spurious bytes, start with a clean slate. A push may be among them. */
+            serial_transport_driver_clear();
+            push_failed = true;
+            return;
+        }
+    }
+}
+
+#endif // SERIAL_USART_SLAVE_PUSH
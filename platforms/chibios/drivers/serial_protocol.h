@@ -40,6 +40,15 @@ bool __attribute__((nonnull, hot)) serial_transport_receive(uint8_t* destination
  */
 bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* destination, const size_t size);
 
+/**
+ * @brief Non-blocking receive of size * bytes, only succeeds if they are
+ * already waiting in the receive queue.
+ *
+ * @return true Receive success.
+ * @return false Not enough data available, partially available data is consumed.
+ */
+bool __attribute__((nonnull, hot)) serial_transport_receive_nowait(uint8_t* destination, const size_t size);
+
 /**
  * @brief Blocking send of buffer with timeout.
  *
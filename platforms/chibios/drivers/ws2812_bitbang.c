@@ -78,17 +78,20 @@ void sendByte(uint8_t byte) {
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+// Interrupts are off for the whole strip while sending, so skip frames that did not change
+static bool ws2812_leds_dirty;
+
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
+
+    // The strip may still show a frame from before a reset
+    ws2812_leds_dirty = true;
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
-#if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
-#endif
+    if (ws2812_update_led(&ws2812_leds[index], red, green, blue)) {
+        ws2812_leds_dirty = true;
+    }
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -98,6 +101,11 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+    if (!ws2812_leds_dirty) {
+        return;
+    }
+    ws2812_leds_dirty = false;
+
     // this code is very time dependent, so we need to disable interrupts
     chSysLock();
 
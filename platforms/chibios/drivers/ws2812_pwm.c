@@ -292,6 +292,13 @@ typedef uint8_t ws2812_buffer_t;
 
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
 
+/*
+ * The circular DMA transfer streams the frame buffer continuously, so the
+ * encoding cost is all that ws2812_flush() adds; keep it down by re-encoding
+ * only the LEDs whose color changed.
+ */
+static bool ws2812_leds_dirty[WS2812_LED_COUNT];
+
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
  * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
@@ -395,12 +402,9 @@ void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b,
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
-#if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
-#endif
+    if (ws2812_update_led(&ws2812_leds[index], red, green, blue)) {
+        ws2812_leds_dirty[index] = true;
+    }
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -411,6 +415,11 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 
 void ws2812_flush(void) {
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        if (!ws2812_leds_dirty[i]) {
+            continue;
+        }
+        ws2812_leds_dirty[i] = false;
+
 #if defined(WS2812_RGBW)
         ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
 #else
@@ -113,7 +113,20 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+// Encode the next frame into one buffer while the other is being sent.
+// A circular transfer never stops reading its buffer, so it only gets one.
+#ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
+#    define TXBUF_COUNT 1
+#else
+#    define TXBUF_COUNT 2
+#endif
+#define TXBUF_DIRTY_ALL ((1 << TXBUF_COUNT) - 1)
+
+static uint8_t txbuf[TXBUF_COUNT][PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+static uint8_t txbuf_back                                                 = 0;
+
+// One bit per buffer that still holds an old color for the LED
+static uint8_t txbuf_dirty[WS2812_LED_COUNT];
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -133,8 +146,8 @@ static uint8_t get_protocol_eq(uint8_t data, int pos) {
     return eq;
 }
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* buffer, ws2812_led_t color, int pos) {
+    uint8_t* tx_start = &buffer[PREAMBLE_SIZE];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
     for (int j = 0; j < 4; j++)
@@ -167,6 +180,11 @@ static void set_led_color_rgb(ws2812_led_t color, int pos) {
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_init(void) {
+    // The strip may still show a frame from before a reset
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        txbuf_dirty[i] = TXBUF_DIRTY_ALL;
+    }
+
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
 #ifdef WS2812_SPI_SCK_PIN
@@ -220,17 +238,14 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[0]), txbuf[0]);
 #endif
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
-#if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
-#endif
+    if (ws2812_update_led(&ws2812_leds[index], red, green, blue)) {
+        txbuf_dirty[index] = TXBUF_DIRTY_ALL;
+    }
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -239,18 +254,42 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     }
 }
 
-void ws2812_flush(void) {
+// Re-encode the LEDs that changed since the back buffer was last sent
+static bool encode_back_buffer(void) {
+    bool changed = false;
+
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+        if (txbuf_dirty[i] & (1 << txbuf_back)) {
+            set_led_color_rgb(txbuf[txbuf_back], ws2812_leds[i], i);
+            txbuf_dirty[i] &= ~(1 << txbuf_back);
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void ws2812_flush(void) {
+#ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
+    encode_back_buffer();
+#else
+    if (!encode_back_buffer()) {
+        // Nothing changed since the last frame was sent
+        return;
+    }
+
+    // Only wait if the previous frame is still being sent from the other buffer
+    while (WS2812_SPI_DRIVER.state == SPI_ACTIVE) {
+        chThdYield();
     }
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, so the next frame is rendered while this one goes out.
+    // Instead spiSend can be used to send synchronously.
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[txbuf_back]), txbuf[txbuf_back]);
 #    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[txbuf_back]), txbuf[txbuf_back]);
 #    endif
+    txbuf_back ^= 1;
 #endif
 }
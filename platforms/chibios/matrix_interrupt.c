@@ -0,0 +1,66 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+
+#ifdef MATRIX_INTERRUPT_SCAN
+#    include "matrix.h"
+
+#    if !defined(PAL_USE_CALLBACKS) || (PAL_USE_CALLBACKS != TRUE)
+#        error MATRIX_INTERRUPT_SCAN requires PAL_USE_CALLBACKS to be set to TRUE in halconf.h
+#    endif
+
+static BSEMAPHORE_DECL(matrix_wakeup, true);
+
+static void matrix_pin_event_cb(void *arg) {
+    (void)arg;
+    chSysLockFromISR();
+    chBSemSignalI(&matrix_wakeup);
+    chSysUnlockFromISR();
+}
+
+bool matrix_interrupt_arm(const pin_t *pins, uint8_t count) {
+    // On STM32 and similar parts an EXTI line serves the same pad number on every port, so two
+    // matrix pins such as A0 and B0 can't both wake the MCU, and a line already in use belongs
+    // to someone else, like the bitbang serial driver. Fall back to polling in either case.
+    uint32_t pads = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] == NO_PIN) {
+            continue;
+        }
+        uint32_t pad = 1UL << PAL_PAD(pins[i]);
+        if (pads & pad) {
+            return false;
+        }
+#    ifdef palIsLineEventEnabled
+        if (palIsLineEventEnabled(pins[i])) {
+            return false;
+        }
+#    endif
+        pads |= pad;
+    }
+
+    chBSemReset(&matrix_wakeup, true);
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] != NO_PIN) {
+            palEnableLineEvent(pins[i], PAL_EVENT_MODE_BOTH_EDGES);
+            palSetLineCallback(pins[i], matrix_pin_event_cb, NULL);
+        }
+    }
+    return true;
+}
+
+void matrix_interrupt_wait(uint16_t timeout_ms) {
+    // Blocking the main thread lets the idle thread run, which executes WFI when CORTEX_ENABLE_WFI_IDLE is set
+    chBSemWaitTimeout(&matrix_wakeup, TIME_MS2I(timeout_ms));
+}
+
+void matrix_interrupt_disarm(const pin_t *pins, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] != NO_PIN) {
+            palDisableLineEvent(pins[i]);
+        }
+    }
+}
+#endif
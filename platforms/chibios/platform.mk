@@ -282,6 +282,7 @@ PLATFORM_SRC = \
         $(CHIBIOS)/os/various/syscalls.c \
         $(PLATFORM_COMMON_DIR)/syscall-fallbacks.c \
         $(PLATFORM_COMMON_DIR)/wait.c \
+        $(PLATFORM_COMMON_DIR)/matrix_interrupt.c \
         $(PLATFORM_COMMON_DIR)/synchronization_util.c \
         $(PLATFORM_COMMON_DIR)/interrupt_handlers.c
 
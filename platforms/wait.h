@@ -21,6 +21,15 @@
 extern "C" {
 #endif
 
+#ifdef HOST_REPORT_COALESCING
+/* Reports held back for the current scan are sent before waiting, so the
+ * host sees the state the keyboard waits in. */
+void host_report_flush(void);
+#    define wait_ms_flush_reports() host_report_flush()
+#else
+#    define wait_ms_flush_reports()
+#endif
+
 #if __has_include_next("_wait.h")
 #    include_next "_wait.h" /* Include the platforms _wait.h */
 #endif
@@ -31,6 +31,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include "debug.h"
 #include "quantum.h"
+#include "deadline_scheduler.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -66,11 +67,18 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
 }
 #endif
 
+#ifdef BENCHMARK
+uint32_t action_exec_count = 0;
+#endif
+
 /** \brief Called to execute an action.
  *
  * FIXME: Needs documentation.
  */
 void action_exec(keyevent_t event) {
+#ifdef BENCHMARK
+    action_exec_count++;
+#endif
     if (IS_EVENT(event)) {
         ac_dprintf("\n---- action_exec: start -----\n");
         ac_dprintf("EVENT: ");
@@ -134,6 +142,31 @@ void action_exec(keyevent_t event) {
 #endif
 }
 
+#ifdef DEADLINE_SCHEDULER_ENABLE
+/** \brief Whether tick events currently have any work to do
+ *
+ * Ticks only advance the tapping state machine and oneshot timeouts.
+ */
+bool action_tick_pending(void) {
+#    ifndef NO_ACTION_TAPPING
+    if (action_tapping_pending()) {
+        return true;
+    }
+#    endif
+#    if !defined(NO_ACTION_ONESHOT) && (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+    if (keymap_config.oneshot_enable && (get_oneshot_mods() || is_oneshot_layer_active())) {
+        return true;
+    }
+#        ifdef SWAP_HANDS_ENABLE
+    if (keymap_config.oneshot_enable && is_oneshot_swaphands_active()) {
+        return true;
+    }
+#        endif
+#    endif
+    return false;
+}
+#endif
+
 #ifdef SWAP_HANDS_ENABLE
 extern const keypos_t PROGMEM hand_swap_config[MATRIX_ROWS][MATRIX_COLS];
 #    ifdef ENCODER_MAP_ENABLE
@@ -58,6 +58,14 @@ typedef struct {
 /* Execute action per keyevent */
 void action_exec(keyevent_t event);
 
+#ifdef BENCHMARK
+/* Number of action_exec() calls, including ticks, read by the host benchmarks */
+extern uint32_t action_exec_count;
+#endif
+
+/* Whether tick events currently have any work to do */
+bool action_tick_pending(void);
+
 /* action for key */
 action_t action_for_key(uint8_t layer, keypos_t key);
 action_t action_for_keycode(uint16_t keycode);
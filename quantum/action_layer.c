@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -289,6 +290,37 @@ uint8_t read_source_layers_cache(keypos_t key) {
 }
 #endif
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+/** \brief layer lookup cache
+ *
+ * Topmost non-transparent layer for each matrix position, valid for the layer mask stored in
+ * layer_lookup_cache_state. Entries are filled lazily and dropped whenever the mask changes.
+ */
+#    define LAYER_LOOKUP_CACHE_EMPTY 0xFF
+
+static uint8_t       layer_lookup_cache[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t layer_lookup_cache_state = 0;
+static bool          layer_lookup_cache_stale = true;
+
+/** \brief Invalidate layer lookup cache
+ *
+ * Drops every cached entry, must be called if the keymap is changed outside of dynamic keymaps
+ */
+void layer_lookup_cache_invalidate(void) {
+    layer_lookup_cache_stale = true;
+}
+
+/** \brief Invalidate layer lookup cache for a single key
+ *
+ * Drops the cached entry of the given key, used when a single keycode changes
+ */
+void layer_lookup_cache_invalidate_key(keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layer_lookup_cache[key.row][key.col] = LAYER_LOOKUP_CACHE_EMPTY;
+    }
+}
+#endif
+
 /** \brief Store or get action (FIXME: Needs better summary)
  *
  * Make sure the action triggered when the key is released is the same
@@ -326,17 +358,40 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_LOOKUP_CACHE
+    const bool cacheable = key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+    if (cacheable) {
+        if (layer_lookup_cache_stale || layer_lookup_cache_state != layers) {
+            memset(layer_lookup_cache, LAYER_LOOKUP_CACHE_EMPTY, sizeof(layer_lookup_cache));
+            layer_lookup_cache_state = layers;
+            layer_lookup_cache_stale = false;
+        }
+        uint8_t cached = layer_lookup_cache[key.row][key.col];
+        if (cached != LAYER_LOOKUP_CACHE_EMPTY) {
+            return cached;
+        }
+    }
+#    endif
     /* check top layer first */
-    for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+    int8_t i = MAX_LAYER - 1;
+    for (; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
-                return i;
+                break;
             }
         }
     }
     /* fall back to layer 0 */
-    return 0;
+    if (i < 0) {
+        i = 0;
+    }
+#    ifdef LAYER_LOOKUP_CACHE
+    if (cacheable) {
+        layer_lookup_cache[key.row][key.col] = i;
+    }
+#    endif
+    return i;
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -112,6 +112,12 @@ void action_tapping_process(keyrecord_t record) {
     }
 }
 
+/** \brief Whether a tapping key or buffered events are waiting on tick events
+ */
+bool action_tapping_pending(void) {
+    return !IS_NOEVENT(tapping_key.event) || waiting_buffer_head != waiting_buffer_tail;
+}
+
 /* Some conditionally defined helper macros to keep process_tapping more
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
@@ -164,6 +164,10 @@ void clear_oneshot_swaphands(void) {
 #        endif
 }
 
+bool is_oneshot_swaphands_active(void) {
+    return swap_hands_oneshot == SHO_ACTIVE;
+}
+
 #    endif
 
 /** \brief Set oneshot layer
@@ -103,6 +103,7 @@ void set_oneshot_swaphands(void);
 void release_oneshot_swaphands(void);
 void use_oneshot_swaphands(void);
 void clear_oneshot_swaphands(void);
+bool is_oneshot_swaphands_active(void);
 #endif
 
 #ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include "caps_word.h"
 #include "timer.h"
+#include "deadline_scheduler.h"
 #include "action.h"
 #include "action_util.h"
 
@@ -32,16 +33,25 @@ static bool caps_word_active = false;
 static uint16_t idle_timer = 0;
 
 void caps_word_task(void) {
-    if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
+    if (caps_word_active) {
+        const uint16_t now = timer_read();
+        if (!timer_expired(now, idle_timer)) {
+            deadline_set(DEADLINE_CAPS_WORD, TIMER_DIFF_16(idle_timer, now));
+            return;
+        }
         caps_word_off();
     }
+    deadline_clear(DEADLINE_CAPS_WORD);
 }
 
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    deadline_wake(DEADLINE_CAPS_WORD);
 }
 #else
-void caps_word_task(void) {}
+void caps_word_task(void) {
+    deadline_clear(DEADLINE_CAPS_WORD);
+}
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
 
 void caps_word_on(void) {
@@ -0,0 +1,64 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "deadline_scheduler.h"
+#include "timer.h"
+
+_Static_assert(DEADLINE_COUNT <= 16, "Too many deadlines for the due mask");
+
+static uint32_t deadlines[DEADLINE_COUNT];
+static uint16_t armed    = 0;
+static uint32_t earliest = 0;
+
+static void deadline_update_earliest(void) {
+    uint32_t now     = timer_read32();
+    int32_t  closest = INT32_MAX;
+    for (uint8_t i = 0; i < DEADLINE_COUNT; i++) {
+        if (armed & DEADLINE_BIT(i)) {
+            int32_t remaining = (int32_t)TIMER_DIFF_32(deadlines[i], now);
+            if (remaining < closest) {
+                closest  = remaining;
+                earliest = deadlines[i];
+            }
+        }
+    }
+}
+
+void deadline_set(deadline_id_t id, uint32_t delay_ms) {
+    deadlines[id] = timer_read32() + delay_ms;
+    armed |= DEADLINE_BIT(id);
+    deadline_update_earliest();
+}
+
+void deadline_clear(deadline_id_t id) {
+    armed &= ~DEADLINE_BIT(id);
+    deadline_update_earliest();
+}
+
+void deadline_wake(deadline_id_t id) {
+    deadline_set(id, 0);
+}
+
+void deadline_wake_all(void) {
+    uint32_t now = timer_read32();
+    for (uint8_t i = 0; i < DEADLINE_COUNT; i++) {
+        deadlines[i] = now;
+    }
+    armed    = DEADLINE_BIT(DEADLINE_COUNT) - 1;
+    earliest = now;
+}
+
+uint16_t deadline_due(void) {
+    uint32_t now = timer_read32();
+    if (!armed || (int32_t)TIMER_DIFF_32(now, earliest) < 0) {
+        return 0;
+    }
+
+    uint16_t due = 0;
+    for (uint8_t i = 0; i < DEADLINE_COUNT; i++) {
+        if ((armed & DEADLINE_BIT(i)) && (int32_t)TIMER_DIFF_32(now, deadlines[i]) >= 0) {
+            due |= DEADLINE_BIT(i);
+        }
+    }
+    return due;
+}
@@ -0,0 +1,80 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \defgroup deadline_scheduler Deadline Scheduler
+ *
+ * \brief Tracks when each timeout driven core feature next needs attention,
+ * so that `quantum_task()` only calls the tasks whose deadline has passed.
+ *
+ * A feature task re-arms its own deadline every time it runs, or clears it
+ * once the feature is idle. Anything that may start a timeout (key events,
+ * `caps_word_on()`, `leader_start()`...) wakes the feature so its task runs on
+ * the next scan and computes a fresh deadline. A deadline that is reached
+ * stays due until the task re-arms or clears it, so a missed update costs
+ * speed but never a timeout.
+ *
+ * Without `DEADLINE_SCHEDULER_ENABLE` the functions compile to nothing and
+ * every task runs on every scan.
+ *
+ * \{
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    DEADLINE_KEY_OVERRIDE,
+    DEADLINE_TAP_DANCE,
+    DEADLINE_COMBO,
+    DEADLINE_LEADER,
+    DEADLINE_AUTO_SHIFT,
+    DEADLINE_CAPS_WORD,
+    DEADLINE_SECURE,
+    DEADLINE_LAYER_LOCK,
+    DEADLINE_COUNT,
+} deadline_id_t;
+
+#define DEADLINE_BIT(id) ((uint16_t)1 << (id))
+
+#ifdef DEADLINE_SCHEDULER_ENABLE
+
+/** \brief Runs the feature's task again once delay_ms milliseconds have passed
+ */
+void deadline_set(deadline_id_t id, uint32_t delay_ms);
+
+/** \brief The feature has no pending timeout, its task is no longer called
+ */
+void deadline_clear(deadline_id_t id);
+
+/** \brief Runs the feature's task on the next scan
+ */
+void deadline_wake(deadline_id_t id);
+
+/** \brief Runs every feature's task on the next scan, used for key events
+ */
+void deadline_wake_all(void);
+
+/** \brief Retrieves the features whose deadline has passed
+ *
+ * \return a mask of DEADLINE_BIT() values, 0 while the earliest deadline is still ahead
+ */
+uint16_t deadline_due(void);
+
+#else
+
+static inline void deadline_set(deadline_id_t id, uint32_t delay_ms) {}
+static inline void deadline_clear(deadline_id_t id) {}
+static inline void deadline_wake(deadline_id_t id) {}
+static inline void deadline_wake_all(void) {}
+static inline uint16_t deadline_due(void) {
+    return UINT16_MAX;
+}
+
+#endif // DEADLINE_SCHEDULER_ENABLE
+
+/** \} */
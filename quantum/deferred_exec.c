@@ -12,31 +12,131 @@
 //------------------------------------
 // Helpers
 //
+// Pending executors are kept in a binary min-heap ordered by trigger time, so the task only ever looks at the ones
+// that have expired. The heap is a permutation of the table's slots stored inside the table itself: heap positions
+// [0, live) hold pending executors, and positions [live, count) hold the free slots, so claiming a slot is O(1).
+//
+// Tokens encode the slot they refer to, plus a per-slot generation so that stale tokens are rejected:
+//     token = generation * count + slot + 1
+//
 
-static deferred_token current_token = 0;
+// Heap positions are 8 bits wide, so only the first 255 slots of a table can be used. Every slot cycles through all
+// generations the 7-bit counter allows, which always fits in a 16-bit token.
+#define MAX_TABLE_COUNT 255
+#define MAX_TABLE_GENERATIONS 128
+_Static_assert((MAX_TABLE_GENERATIONS - 1) * MAX_TABLE_COUNT + MAX_TABLE_COUNT <= UINT16_MAX, "Deferred executor tokens are too narrow for the generation count");
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static uint8_t free_rotor = 0;
+
+static inline uint8_t table_count_clamp(size_t table_count) {
+    return table_count > MAX_TABLE_COUNT ? MAX_TABLE_COUNT : (uint8_t)table_count;
+}
+
+// Both mappings are stored XOR'ed with their own index, so that a zero-initialised table is the identity permutation
+static inline uint8_t heap_slot(deferred_executor_t *table, uint8_t pos) {
+    return table[pos].heap_slot ^ pos;
+}
+
+static inline uint8_t heap_pos(deferred_executor_t *table, uint8_t slot) {
+    return table[slot].heap_pos ^ slot;
+}
+
+static inline void heap_place(deferred_executor_t *table, uint8_t pos, uint8_t slot) {
+    table[pos].heap_slot = slot ^ pos;
+    table[slot].heap_pos = pos ^ slot;
+}
+
+static inline void heap_swap(deferred_executor_t *table, uint8_t a, uint8_t b) {
+    uint8_t slot_a = heap_slot(table, a);
+    heap_place(table, a, heap_slot(table, b));
+    heap_place(table, b, slot_a);
+}
+
+// Executors that already ran during the current task pass sort after everything else, see deferred_exec_advanced_task()
+static inline bool heap_before(deferred_executor_t *table, uint8_t a, uint8_t b) {
+    deferred_executor_t *entry_a = &table[heap_slot(table, a)];
+    deferred_executor_t *entry_b = &table[heap_slot(table, b)];
+    if (entry_a->ran != entry_b->ran) {
+        return entry_b->ran;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+    return ((int32_t)TIMER_DIFF_32(entry_a->trigger_time, entry_b->trigger_time)) < 0;
+}
+
+// Pending executors always form a prefix of the heap, so the boundary can be found with a binary search
+static uint8_t heap_live_count(deferred_executor_t *table, uint8_t count) {
+    uint8_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint8_t mid = lo + (hi - lo) / 2;
+        if (table[heap_slot(table, mid)].token != INVALID_DEFERRED_TOKEN) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
-    return true;
+    return lo;
+}
+
+static uint8_t heap_sift_up(deferred_executor_t *table, uint8_t pos) {
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (!heap_before(table, pos, parent)) {
+            break;
+        }
+        heap_swap(table, pos, parent);
+        pos = parent;
+    }
+    return pos;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void heap_sift_down(deferred_executor_t *table, uint8_t live, uint8_t pos) {
+    while (true) {
+        uint16_t left     = 2 * (uint16_t)pos + 1;
+        uint8_t  earliest = pos;
+        if (left < live && heap_before(table, left, earliest)) {
+            earliest = left;
         }
+        if (left + 1 < live && heap_before(table, left + 1, earliest)) {
+            earliest = left + 1;
+        }
+        if (earliest == pos) {
+            break;
+        }
+        heap_swap(table, pos, earliest);
+        pos = earliest;
+    }
+}
+
+static void heap_fix(deferred_executor_t *table, uint8_t live, uint8_t pos) {
+    if (heap_sift_up(table, pos) == pos) {
+        heap_sift_down(table, live, pos);
+    }
+}
+
+static void heap_remove(deferred_executor_t *table, uint8_t count, uint8_t slot) {
+    uint8_t live = heap_live_count(table, count);
+    uint8_t pos  = heap_pos(table, slot);
+
+    // Move the last pending executor into the hole, leaving the removed slot at the start of the free area
+    heap_swap(table, pos, live - 1);
+
+    deferred_executor_t *entry = &table[slot];
+    entry->token               = INVALID_DEFERRED_TOKEN;
+    entry->ran                 = false;
+    entry->trigger_time        = 0;
+    entry->callback            = NULL;
+    entry->cb_arg              = NULL;
+
+    if (pos < live - 1) {
+        heap_fix(table, live - 1, pos);
+    }
+}
+
+static inline deferred_executor_t *find_entry(deferred_executor_t *table, uint8_t count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return NULL;
     }
-    return current_token;
+    deferred_executor_t *entry = &table[(deferred_token)(token - 1) % count];
+    return entry->token == token ? entry : NULL;
 }
 
 //------------------------------------
@@ -49,27 +149,30 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Free slots sit right after the pending executors
+    uint8_t count = table_count_clamp(table_count);
+    uint8_t live  = heap_live_count(table, count);
+    if (live == count) {
+        // None available
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Rotate through the free slots rather than always reusing the most recently freed one, so that a slot's tokens
+    // take as long as possible to come around again
+    heap_swap(table, live, live + (++free_rotor % (count - live)));
+    uint8_t slot = heap_slot(table, live);
+
+    // Work out the new token value, bumping the slot's generation so stale tokens no longer match
+    deferred_executor_t *entry = &table[slot];
+    entry->generation          = (entry->generation + 1) % MAX_TABLE_GENERATIONS;
+
+    // Set up the executor table entry
+    entry->token        = entry->generation * count + slot + 1;
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    heap_sift_up(table, live);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +182,18 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    uint8_t              count = table_count_clamp(table_count);
+    deferred_executor_t *entry = find_entry(table, count, token);
+    if (!entry) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->ran          = false;
+    heap_fix(table, heap_live_count(table, count), heap_pos(table, entry - table));
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +203,16 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    uint8_t              count = table_count_clamp(table_count);
+    deferred_executor_t *entry = find_entry(table, count, token);
+    if (!entry) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    heap_remove(table, count, entry - table);
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +222,56 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        uint8_t count = table_count_clamp(table_count);
+
+        // Run through the expired executors, earliest first. Each one is invoked at most once per pass: if it re-queues
+        // itself with a trigger time that has already passed, it is flagged so it sorts behind everything else until
+        // the pass is over.
+        bool any_ran = false;
+        while (true) {
+            uint8_t              slot       = heap_slot(table, 0);
+            deferred_executor_t *entry      = &table[slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            // Check if we're supposed to execute this entry, nothing further down the heap can be due if not
+            if (curr_token == INVALID_DEFERRED_TOKEN || entry->ran || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+                if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                    entry->ran = true;
+                    any_ran    = true;
                 }
+                heap_fix(table, heap_live_count(table, count), heap_pos(table, slot));
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                heap_remove(table, count, slot);
+            }
+        }
+
+        // Executors running behind schedule get their turn again on the next pass, so restore their ordering
+        if (any_ran) {
+            uint8_t live = heap_live_count(table, count);
+            for (uint8_t pos = 0; pos < live; ++pos) {
+                table[heap_slot(table, pos)].ran = false;
+            }
+            for (uint8_t pos = live / 2; pos > 0; --pos) {
+                heap_sift_down(table, live, pos - 1);
             }
         }
     }
@@ -14,7 +14,7 @@
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
  */
-typedef uint8_t deferred_token;
+typedef uint16_t deferred_token;
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -76,6 +76,10 @@ void deferred_exec_task(void);
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                generation : 7;
+    bool                   ran : 1;
+    uint8_t                heap_slot;
+    uint8_t                heap_pos;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
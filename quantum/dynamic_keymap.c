@@ -17,6 +17,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
@@ -101,6 +102,54 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// Native-endian copies of the keymaps and encoder maps in EEPROM, loaded on first use and written through on changes
+static uint16_t keymap_mirror[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t encoder_mirror[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][2];
+#    endif // ENCODER_MAP_ENABLE
+static bool mirror_loaded = false;
+
+static void dynamic_keymap_mirror_read(uint16_t *words, const void *source, uint16_t count) {
+    // Big endian in EEPROM, converted in place
+    eeprom_read_block(words, source, count * 2);
+    uint8_t *bytes = (uint8_t *)words;
+    for (uint16_t i = 0; i < count; i++) {
+        words[i] = ((uint16_t)bytes[i * 2] << 8) | bytes[i * 2 + 1];
+    }
+}
+
+static void dynamic_keymap_mirror_load(void) {
+    dynamic_keymap_mirror_read(&keymap_mirror[0][0][0], (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS);
+#    if defined(ENCODER_MAP_ENABLE) && NUM_ENCODERS > 0
+    dynamic_keymap_mirror_read(&encoder_mirror[0][0][0], (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2);
+#    endif
+    mirror_loaded = true;
+}
+
+static inline void dynamic_keymap_mirror_ensure_loaded(void) {
+    if (!mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+}
+
+// Writes a run of mirrored words back to EEPROM as big endian
+static void dynamic_keymap_mirror_persist(const uint16_t *words, void *target, uint16_t count) {
+    uint8_t buffer[16];
+    while (count > 0) {
+        uint16_t chunk = count < sizeof(buffer) / 2 ? count : sizeof(buffer) / 2;
+        for (uint16_t i = 0; i < chunk; i++) {
+            buffer[i * 2]     = (uint8_t)(words[i] >> 8);
+            buffer[i * 2 + 1] = (uint8_t)(words[i] & 0xFF);
+        }
+        eeprom_write_block(buffer, target, chunk * 2);
+        words += chunk;
+        target += chunk * 2;
+        count -= chunk;
+    }
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +161,33 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    return keymap_mirror[layer][row][column];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    if (keymap_mirror[layer][row][column] == keycode) return;
+    keymap_mirror[layer][row][column] = keycode;
+    dynamic_keymap_mirror_persist(&keymap_mirror[layer][row][column], address, 1);
+#else
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+    keypos_t key = {.row = row, .col = column};
+    layer_lookup_cache_invalidate_key(key);
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,23 +197,40 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    return encoder_mirror[layer][encoder_id][clockwise ? 0 : 1];
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    uint16_t *mirror = &encoder_mirror[layer][encoder_id][clockwise ? 0 : 1];
+    if (*mirror == keycode) return;
+    *mirror = keycode;
+    dynamic_keymap_mirror_persist(mirror, address + (clockwise ? 0 : 2), 1);
+#    else
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 #endif // ENCODER_MAP_ENABLE
 
 void dynamic_keymap_reset(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // The EEPROM may have been erased underneath the mirror, so compare against what it really holds
+    mirror_loaded = false;
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
     // Reset the keymaps in EEPROM to what is in flash.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
@@ -165,10 +245,24 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+    layer_lookup_cache_invalidate();
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    const uint16_t *words = &keymap_mirror[0][0][0];
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t position = offset + i;
+        if (position < dynamic_keymap_eeprom_size) {
+            // Big endian, same as in EEPROM
+            data[i] = (position & 1) ? (uint8_t)(words[position / 2] & 0xFF) : (uint8_t)(words[position / 2] >> 8);
+        } else {
+            data[i] = 0x00;
+        }
+    }
+#else
     void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
@@ -180,10 +274,42 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_ensure_loaded();
+    uint16_t *words = &keymap_mirror[0][0][0];
+    uint16_t  count = dynamic_keymap_eeprom_size / 2;
+    uint16_t  first = offset / 2;
+    uint16_t  last  = (offset + size + 1) / 2; // one past the last word touched
+    if (last > count) last = count;
+
+    // Update the mirror a word at a time, and write each run of changed words back in one go
+    uint16_t run_start = first;
+    for (uint16_t word = first; word <= last; word++) {
+        bool changed = false;
+        if (word < last) {
+            uint16_t value = words[word];
+            for (uint8_t b = 0; b < 2; b++) {
+                uint16_t position = word * 2 + b;
+                if (position < offset || position >= offset + size) continue;
+                uint8_t byte = data[position - offset];
+                value        = b ? ((value & 0xFF00) | byte) : ((value & 0x00FF) | ((uint16_t)byte << 8));
+            }
+            changed     = value != words[word];
+            words[word] = value;
+        }
+        if (!changed) {
+            if (word > run_start) {
+                dynamic_keymap_mirror_persist(&words[run_start], ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + run_start * 2, word - run_start);
+            }
+            run_start = word + 1;
+        }
+    }
+#else
     void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
@@ -193,6 +319,8 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+    layer_lookup_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +348,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +362,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "deadline_scheduler.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -107,6 +108,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
+#ifdef I2C_ASYNC_ENABLE
+#    include "i2c_master.h"
+#endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
@@ -143,6 +147,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#ifdef SCAN_PROFILER_ENABLE
+#    include "scan_profiler.h"
+#    define scan_profiler_mark_stage(stage) scan_profiler_mark(SCAN_PROFILER_STAGE_##stage)
+#else
+#    define scan_profiler_begin()
+#    define scan_profiler_mark_stage(stage)
+#    define scan_profiler_end()
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -518,7 +530,14 @@ static inline void generate_tick_event(void) {
     static uint16_t last_tick = 0;
     const uint16_t  now       = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
+#ifdef DEADLINE_SCHEDULER_ENABLE
+        // Ticks only drive tapping and oneshot timeouts, skip them while neither is pending
+        if (action_tick_pending()) {
+            action_exec(MAKE_TICK_EVENT);
+        }
+#else
         action_exec(MAKE_TICK_EVENT);
+#endif
         last_tick = now;
     }
 }
@@ -595,6 +614,9 @@ void quantum_task(void) {
     if (!is_keyboard_master()) return;
 #endif
 
+    // Features with timeouts are only run once their deadline has passed
+    __attribute__((unused)) const uint16_t due = deadline_due();
+
 #if defined(AUDIO_ENABLE) && defined(AUDIO_INIT_DELAY)
     // There are some tasks that need to be run a little bit
     // after keyboard startup, or else they will not work correctly
@@ -620,7 +642,9 @@ void quantum_task(void) {
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    if (due & DEADLINE_BIT(DEADLINE_KEY_OVERRIDE)) {
+        key_override_task();
+    }
 #endif
 
 #ifdef SEQUENCER_ENABLE
@@ -628,15 +652,21 @@ void quantum_task(void) {
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    if (due & DEADLINE_BIT(DEADLINE_TAP_DANCE)) {
+        tap_dance_task();
+    }
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    if (due & DEADLINE_BIT(DEADLINE_COMBO)) {
+        combo_task();
+    }
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    if (due & DEADLINE_BIT(DEADLINE_LEADER)) {
+        leader_task();
+    }
 #endif
 
 #ifdef WPM_ENABLE
@@ -648,50 +678,72 @@ void quantum_task(void) {
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    if (due & DEADLINE_BIT(DEADLINE_AUTO_SHIFT)) {
+        autoshift_matrix_scan();
+    }
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    if (due & DEADLINE_BIT(DEADLINE_CAPS_WORD)) {
+        caps_word_task();
+    }
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    if (due & DEADLINE_BIT(DEADLINE_SECURE)) {
+        secure_task();
+    }
 #endif
 
 #ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
+    if (due & DEADLINE_BIT(DEADLINE_LAYER_LOCK)) {
+        layer_lock_task();
+    }
 #endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
+    scan_profiler_begin();
+#ifdef HOST_REPORT_COALESCING
+    host_report_transaction_begin();
+#endif
     if (matrix_task()) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
+    scan_profiler_mark_stage(MATRIX);
 
     quantum_task();
+#ifdef I2C_ASYNC_ENABLE
+    i2c_async_task();
+#endif
+    scan_profiler_mark_stage(QUANTUM);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
+    scan_profiler_mark_stage(SPLIT_WATCHDOG);
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
     rgblight_task();
+    scan_profiler_mark_stage(RGBLIGHT);
 #endif
 
 #ifdef LED_MATRIX_ENABLE
     led_matrix_task();
+    scan_profiler_mark_stage(LED_MATRIX);
 #endif
 #ifdef RGB_MATRIX_ENABLE
     rgb_matrix_task();
+    scan_profiler_mark_stage(RGB_MATRIX);
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
     backlight_task();
+    scan_profiler_mark_stage(BACKLIGHT);
 #    endif
 #endif
 
@@ -700,6 +752,7 @@ void keyboard_task(void) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
+    scan_profiler_mark_stage(ENCODER);
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
@@ -707,6 +760,7 @@ void keyboard_task(void) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
+    scan_profiler_mark_stage(POINTING_DEVICE);
 #endif
 
 #ifdef OLED_ENABLE
@@ -715,6 +769,7 @@ void keyboard_task(void) {
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
 #    endif
+    scan_profiler_mark_stage(OLED);
 #endif
 
 #ifdef ST7565_ENABLE
@@ -723,36 +778,51 @@ void keyboard_task(void) {
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
 #    endif
+    scan_profiler_mark_stage(ST7565);
 #endif
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
     mousekey_task();
+    scan_profiler_mark_stage(MOUSEKEY);
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
     ps2_mouse_task();
+    scan_profiler_mark_stage(PS2_MOUSE);
 #endif
 
 #ifdef MIDI_ENABLE
     midi_task();
+    scan_profiler_mark_stage(MIDI);
 #endif
 
 #ifdef JOYSTICK_ENABLE
     joystick_task();
+    scan_profiler_mark_stage(JOYSTICK);
 #endif
 
 #ifdef BLUETOOTH_ENABLE
     bluetooth_task();
+    scan_profiler_mark_stage(BLUETOOTH);
 #endif
 
 #ifdef HAPTIC_ENABLE
     haptic_task();
+    scan_profiler_mark_stage(HAPTIC);
 #endif
 
     led_task();
+    scan_profiler_mark_stage(LED);
 
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
+    scan_profiler_mark_stage(OS_DETECTION);
 #endif
+
+#ifdef HOST_REPORT_COALESCING
+    host_report_transaction_end();
+#endif
+
+    scan_profiler_end();
 }
@@ -3,6 +3,7 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "deadline_scheduler.h"
 #include "util.h"
 
 #include <string.h>
@@ -30,6 +31,7 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    deadline_wake(DEADLINE_LEADER);
 }
 
 void leader_end(void) {
@@ -41,6 +43,17 @@ void leader_task(void) {
     if (leader_sequence_active() && leader_sequence_timed_out()) {
         leader_end();
     }
+
+#if defined(LEADER_NO_TIMEOUT)
+    if (leader_sequence_active() && leader_sequence_size > 0) {
+#else
+    if (leader_sequence_active()) {
+#endif
+        uint16_t elapsed = timer_elapsed(leader_time);
+        deadline_set(DEADLINE_LEADER, elapsed <= LEADER_TIMEOUT ? LEADER_TIMEOUT + 1 - elapsed : 0);
+    } else {
+        deadline_clear(DEADLINE_LEADER);
+    }
 }
 
 bool leader_sequence_active(void) {
@@ -74,6 +87,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    deadline_wake(DEADLINE_LEADER);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
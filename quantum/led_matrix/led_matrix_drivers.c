@@ -28,7 +28,7 @@
 #if defined(LED_MATRIX_IS31FL3218)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3218_init,
-    .flush         = is31fl3218_update_pwm_buffers,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3218_set_value,
     .set_value_all = is31fl3218_set_value_all,
 };
@@ -36,7 +36,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3236)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3236_init_drivers,
-    .flush         = is31fl3236_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3236_set_value,
     .set_value_all = is31fl3236_set_value_all,
 };
@@ -44,7 +44,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3729)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3729_init_drivers,
-    .flush         = is31fl3729_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3729_set_value,
     .set_value_all = is31fl3729_set_value_all,
 };
@@ -52,7 +52,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3731)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3731_init_drivers,
-    .flush         = is31fl3731_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3731_set_value,
     .set_value_all = is31fl3731_set_value_all,
 };
@@ -60,7 +60,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3733)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3733_init_drivers,
-    .flush         = is31fl3733_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3733_set_value,
     .set_value_all = is31fl3733_set_value_all,
 };
@@ -68,7 +68,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3736)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3736_init_drivers,
-    .flush         = is31fl3736_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3736_set_value,
     .set_value_all = is31fl3736_set_value_all,
 };
@@ -76,7 +76,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3737)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3737_init_drivers,
-    .flush         = is31fl3737_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3737_set_value,
     .set_value_all = is31fl3737_set_value_all,
 };
@@ -84,7 +84,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3741)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3741_init_drivers,
-    .flush         = is31fl3741_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3741_set_value,
     .set_value_all = is31fl3741_set_value_all,
 };
@@ -92,7 +92,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3742A)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3742a_init_drivers,
-    .flush         = is31fl3742a_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3742a_set_value,
     .set_value_all = is31fl3742a_set_value_all,
 };
@@ -100,7 +100,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3743A)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3743a_init_drivers,
-    .flush         = is31fl3743a_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3743a_set_value,
     .set_value_all = is31fl3743a_set_value_all,
 };
@@ -108,7 +108,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3745)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3745_init_drivers,
-    .flush         = is31fl3745_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3745_set_value,
     .set_value_all = is31fl3745_set_value_all,
 };
@@ -116,7 +116,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_IS31FL3746A)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3746a_init_drivers,
-    .flush         = is31fl3746a_flush,
+    .flush         = is31_common_flush,
     .set_value     = is31fl3746a_set_value,
     .set_value_all = is31fl3746a_set_value_all,
 };
@@ -124,7 +124,7 @@ const led_matrix_driver_t led_matrix_driver = {
 #elif defined(LED_MATRIX_SNLED27351)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = snled27351_init_drivers,
-    .flush         = snled27351_flush,
+    .flush         = is31_common_flush,
     .set_value     = snled27351_set_value,
     .set_value_all = snled27351_set_value_all,
 };
@@ -7,30 +7,43 @@
 
 #if defined(LED_MATRIX_IS31FL3218)
 #    include "is31fl3218-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3236)
 #    include "is31fl3236-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3729)
 #    include "is31fl3729-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3731)
 #    include "is31fl3731-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3733)
 #    include "is31fl3733-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3736)
 #    include "is31fl3736-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3737)
 #    include "is31fl3737-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3741)
 #    include "is31fl3741-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3742A)
 #    include "is31fl3742a-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3743A)
 #    include "is31fl3743a-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3745)
 #    include "is31fl3745-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_IS31FL3746A)
 #    include "is31fl3746a-mono.h"
+#    include "is31_common.h"
 #elif defined(LED_MATRIX_SNLED27351)
 #    include "snled27351-mono.h"
+#    include "is31_common.h"
 #endif
 
 typedef struct {
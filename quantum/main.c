@@ -16,6 +16,10 @@
 
 #include "keyboard.h"
 
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
+
 void platform_setup(void);
 
 void protocol_setup(void);
@@ -72,6 +76,11 @@ int main(void) {
         deferred_exec_task();
 #endif // DEFERRED_EXEC_ENABLE
 
+#ifdef EEPROM_DRIVER
+        // Write back any EEPROM changes the driver has deferred
+        eeprom_driver_task();
+#endif // EEPROM_DRIVER
+
         housekeeping_task();
     }
 }
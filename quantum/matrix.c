@@ -51,6 +51,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+#if defined(MATRIX_INTERRUPT_SCAN) && !defined(MATRIX_INTERRUPT_SCAN_TIMEOUT)
+#    define MATRIX_INTERRUPT_SCAN_TIMEOUT 1
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -133,6 +137,15 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#    ifdef MATRIX_INTERRUPT_SCAN
+#        define MATRIX_INTERRUPT_PINS (&direct_pins[0][0])
+#        define MATRIX_INTERRUPT_PIN_COUNT (ROWS_PER_HAND * MATRIX_COLS)
+
+// Direct pins are always readable, nothing needs to be driven
+static void matrix_select_all(void) {}
+static void matrix_unselect_all(void) {}
+#    endif
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
@@ -198,6 +211,22 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            ifdef MATRIX_INTERRUPT_SCAN
+#                define MATRIX_INTERRUPT_PINS (col_pins)
+#                define MATRIX_INTERRUPT_PIN_COUNT (MATRIX_COLS)
+
+// Drive every row so that any pressed key pulls its col pin
+static void matrix_select_all(void) {
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        select_row(x);
+    }
+}
+
+static void matrix_unselect_all(void) {
+    unselect_rows();
+}
+#            endif
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -262,6 +291,22 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     matrix_output_unselect_delay(current_col, key_pressed); // wait for all Row signals to go HIGH
 }
 
+#            ifdef MATRIX_INTERRUPT_SCAN
+#                define MATRIX_INTERRUPT_PINS (row_pins)
+#                define MATRIX_INTERRUPT_PIN_COUNT (ROWS_PER_HAND)
+
+// Drive every col so that any pressed key pulls its row pin
+static void matrix_select_all(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        select_col(x);
+    }
+}
+
+static void matrix_unselect_all(void) {
+    unselect_cols();
+}
+#            endif
+
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
@@ -320,7 +365,88 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
+#ifdef MATRIX_INTERRUPT_SCAN
+static bool matrix_any_input_pressed(void) {
+    const pin_t *pins = MATRIX_INTERRUPT_PINS;
+    for (uint8_t i = 0; i < MATRIX_INTERRUPT_PIN_COUNT; i++) {
+        if (pins[i] != NO_PIN && gpio_read_pin(pins[i]) == MATRIX_INPUT_PRESSED_STATE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether the pin change events are enabled, which they stay for as long as the matrix is idle
+static bool matrix_interrupt_armed = false;
+
+static void matrix_idle_end(void) {
+    if (matrix_interrupt_armed) {
+        matrix_interrupt_disarm(MATRIX_INTERRUPT_PINS, MATRIX_INTERRUPT_PIN_COUNT);
+        matrix_interrupt_armed = false;
+    }
+}
+
+/**
+ * \brief Checks whether the matrix can be left alone this scan.
+ *
+ * Both the raw and the debounced state of this half must be empty, so that the debounce
+ * algorithm has nothing left to report. All lines are then driven at once and, if no input
+ * is active, the MCU sleeps until a pin changes or MATRIX_INTERRUPT_SCAN_TIMEOUT expires.
+ * The pin change events are enabled when the matrix goes idle and disabled once a key is
+ * detected, rather than on every scan.
+ *
+ * \return true if no key is pressed and the full scan can be skipped
+ */
+static bool matrix_idle_wait(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+#    ifdef SPLIT_KEYBOARD
+        if (raw_matrix[row] || matrix[thisHand + row]) {
+#    else
+        if (raw_matrix[row] || matrix[row]) {
+#    endif
+            matrix_idle_end();
+            return false;
+        }
+    }
+
+    matrix_select_all();
+    matrix_output_select_delay();
+
+    bool pressed = matrix_any_input_pressed();
+    if (!pressed && matrix_can_sleep_kb()) {
+        if (!matrix_interrupt_armed) {
+            // Arm before re-reading so that an edge between the two can't be missed
+            matrix_interrupt_armed = matrix_interrupt_arm(MATRIX_INTERRUPT_PINS, MATRIX_INTERRUPT_PIN_COUNT);
+        }
+        // An edge since the last wait leaves the wakeup pending, so the wait returns straight away
+        if (matrix_interrupt_armed && !matrix_any_input_pressed()) {
+            matrix_interrupt_wait(MATRIX_INTERRUPT_SCAN_TIMEOUT);
+        }
+        pressed = matrix_any_input_pressed();
+    }
+
+    matrix_unselect_all();
+    if (pressed) {
+        matrix_idle_end();
+        // Let the lines settle before the regular scan selects them one by one
+        matrix_output_unselect_delay(0, true);
+    }
+    return !pressed;
+}
+#endif
+
 uint8_t matrix_scan(void) {
+#ifdef MATRIX_INTERRUPT_SCAN
+    if (matrix_idle_wait()) {
+#    ifdef SPLIT_KEYBOARD
+        return (uint8_t)matrix_post_scan();
+#    else
+        matrix_scan_kb();
+        return 0;
+#    endif
+    }
+#endif
+
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
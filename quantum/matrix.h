@@ -75,6 +75,18 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+#ifdef MATRIX_INTERRUPT_SCAN
+/* whether the matrix may sleep while idle, waiting for a pin change */
+bool matrix_can_sleep_kb(void);
+bool matrix_can_sleep_user(void);
+
+/* platform hooks used to sleep until one of the matrix input pins changes,
+ * arm returns false if the pins can't wake the MCU and the matrix has to be polled */
+bool matrix_interrupt_arm(const pin_t *pins, uint8_t count);
+void matrix_interrupt_wait(uint16_t timeout_ms);
+void matrix_interrupt_disarm(const pin_t *pins, uint8_t count);
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
@@ -133,6 +133,22 @@ __attribute__((weak)) void matrix_output_unselect_delay(uint8_t line, bool key_p
     matrix_io_delay();
 }
 
+#ifdef MATRIX_INTERRUPT_SCAN
+__attribute__((weak)) bool matrix_can_sleep_kb(void) {
+    return matrix_can_sleep_user();
+}
+__attribute__((weak)) bool matrix_can_sleep_user(void) {
+    return true;
+}
+
+// Platforms without pin change support only get the cheap idle check, without sleeping
+__attribute__((weak)) bool matrix_interrupt_arm(const pin_t *pins, uint8_t count) {
+    return false;
+}
+__attribute__((weak)) void matrix_interrupt_wait(uint16_t timeout_ms) {}
+__attribute__((weak)) void matrix_interrupt_disarm(const pin_t *pins, uint8_t count) {}
+#endif
+
 // CUSTOM MATRIX 'LITE'
 __attribute__((weak)) void matrix_init_custom(void) {}
 __attribute__((weak)) bool matrix_scan_custom(matrix_row_t current_matrix[]) {
@@ -72,6 +72,61 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_DECODE_BLOCK_PIXELS
+/**
+ * @def This controls how many pixels are decoded at a time when drawing images and fonts. Larger blocks mean fewer
+ *      calls into the display driver, at the cost of stack space while drawing. Must be a multiple of 8.
+ */
+#    define QUANTUM_PAINTER_DECODE_BLOCK_PIXELS 64
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls how many decoded font glyphs are kept in RAM, so that redrawing frequently used characters skips
+ *      decoding the font entirely. The least recently drawn glyph is evicted when the cache is full. Set to 0 to
+ *      disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) reserved for each glyph in the glyph cache. Glyphs that are larger
+ *      once converted to the display's native pixel format are drawn without being cached.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 256
+#endif
+
+#ifndef QUANTUM_PAINTER_TEXT_RUN_LENGTH
+/**
+ * @def This controls the maximum length (in bytes, including the terminator) of the string remembered by a text run.
+ *      Longer strings are still drawn, but are redrawn in full on the next update.
+ */
+#    define QUANTUM_PAINTER_TEXT_RUN_LENGTH 32
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS
+/**
+ * @def This controls where the images and fonts in external flash start, as used by \ref qp_flash_asset_address.
+ */
+#    define QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS 0
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_CACHE_BLOCKS
+/**
+ * @def This controls how many blocks of external flash are cached in RAM while drawing images and fonts loaded with
+ *      \ref qp_load_image_flash or \ref qp_load_font_flash.
+ */
+#    define QUANTUM_PAINTER_FLASH_CACHE_BLOCKS 4
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE
+/**
+ * @def This controls the size (in bytes) of each cached block of external flash. Must be a power of two.
+ */
+#    define QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE 256
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -129,6 +184,25 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef A piece of text kept on screen by \ref qp_textrun_update, which only redraws the glyphs that changed.
+ *          Initialise with \ref qp_textrun_init; the members should be treated as read-only.
+ */
+typedef struct painter_text_run_t {
+    painter_device_t      device;
+    painter_font_handle_t font;
+    uint16_t              x;
+    uint16_t              y;
+    uint8_t               hue_fg;
+    uint8_t               sat_fg;
+    uint8_t               val_fg;
+    uint8_t               hue_bg;
+    uint8_t               sat_bg;
+    uint8_t               val_bg;
+    int16_t               width;                                 ///< Width (in pixels) of the text currently drawn
+    char                  text[QUANTUM_PAINTER_TEXT_RUN_LENGTH]; ///< Text currently drawn, empty if it was too long to remember
+} painter_text_run_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -353,6 +427,38 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads an image stored in external flash, such as a raw QGF file written with `qmk painter-convert-graphics --raw`.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param address[in] the location of the image in external flash, see \ref qp_flash_asset_address
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+
+#    define QP_FLASH_ASSET_NOT_FOUND 0xFFFFFFFF
+
+/**
+ * Finds an asset within the images and fonts stored back-to-back in external flash, starting at
+ * \ref QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS. Assets are numbered in the order they were written, starting at zero.
+ *
+ * @param index[in] the number of the asset to find
+ * @return the address usable with \ref qp_load_image_flash or \ref qp_load_font_flash
+ * @return QP_FLASH_ASSET_NOT_FOUND if there are not enough assets in flash
+ */
+uint32_t qp_flash_asset_address(uint16_t index);
+
+/**
+ * Drops all cached external flash data. Must be invoked if the external flash is rewritten while images or fonts
+ * stored in it are in use.
+ */
+void qp_flash_stream_invalidate_cache(void);
+#endif // FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +546,19 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads a font stored in external flash, such as a raw QFF file written with `qmk painter-convert-font-image --raw`.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the location of the font in external flash, see \ref qp_flash_asset_address
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+#endif // FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
@@ -488,6 +607,41 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Sets up a text run at the given location. Nothing is drawn until \ref qp_textrun_update is invoked.
+ *
+ * @param run[out] the text run to initialise
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param font[in] the handle of the font
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ */
+void qp_textrun_init(painter_text_run_t *run, painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Replaces the text of a text run, only redrawing the glyphs that differ from the text already on screen. If the new
+ * text is narrower, the remainder of the previous text is cleared using the background color.
+ *
+ * @param run[in] the text run to update
+ * @param str[in] the string to draw
+ * @return the width (in pixels) of the new text
+ */
+int16_t qp_textrun_update(painter_text_run_t *run, const char *str);
+
+/**
+ * Redraws the entire text run, such as after the display has been cleared.
+ *
+ * @param run[in] the text run to redraw
+ * @return the width (in pixels) of the text
+ */
+int16_t qp_textrun_redraw(painter_text_run_t *run);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -2,6 +2,7 @@
 // Copyright 2023 Pablo Martinez (@elpekenin) <elpekenin@elpekenin.dev>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
@@ -165,43 +166,263 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     return true;
 }
 
-// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
-    painter_driver_t* driver = (painter_driver_t*)device;
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Block pull of bytes, push of pixels
+
+_Static_assert(QUANTUM_PAINTER_DECODE_BLOCK_PIXELS % 8 == 0, "QUANTUM_PAINTER_DECODE_BLOCK_PIXELS must be a multiple of 8");
+
+static bool qp_drawimage_block_uncompressed_decoder(qp_internal_byte_input_state_t* state, uint8_t* buffer, uint32_t length) {
+    return qp_stream_read(buffer, 1, length, state->src_stream) == length;
+}
+
+static bool qp_drawimage_block_rle_decoder(qp_internal_byte_input_state_t* state, uint8_t* buffer, uint32_t length) {
+    while (length > 0) {
+        // Work out if we're parsing the initial marker byte
+        if (state->rle.mode == MARKER_BYTE) {
+            int16_t c = qp_stream_get(state->src_stream);
+            if (c < 0) {
+                return false;
+            }
+            if (c >= 128) {
+                state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+                state->rle.remain = c - 127;
+            } else {
+                state->rle.mode   = REPEATING_RUN; // repeated run
+                state->rle.remain = c;
+                state->curr       = qp_stream_get(state->src_stream);
+                if (state->curr < 0) {
+                    return false;
+                }
+            }
+        }
+
+        // Copy out as much of the current run as fits
+        uint8_t count = length < state->rle.remain ? length : state->rle.remain;
+        if (state->rle.mode == REPEATING_RUN) {
+            memset(buffer, state->curr, count);
+        } else if (qp_stream_read(buffer, 1, count, state->src_stream) != count) {
+            return false;
+        }
+
+        buffer += count;
+        length -= count;
+        state->rle.remain -= count;
+        if (state->rle.remain == 0) {
+            // Swap back to querying the marker byte mode
+            state->rle.mode = MARKER_BYTE;
+        }
+    }
+
+    return true;
+}
+
+// Pulls a block of decompressed bytes, skipping the per-byte callback for the decoders set up by qp_internal_prepare_input_state
+static bool qp_internal_read_block(qp_internal_byte_input_callback input_callback, void* input_state, uint8_t* buffer, uint32_t length) {
+    if (input_callback == qp_drawimage_byte_uncompressed_decoder) {
+        return qp_drawimage_block_uncompressed_decoder((qp_internal_byte_input_state_t*)input_state, buffer, length);
+    }
+    if (input_callback == qp_drawimage_byte_rle_decoder) {
+        return qp_drawimage_block_rle_decoder((qp_internal_byte_input_state_t*)input_state, buffer, length);
+    }
+
+    for (uint32_t i = 0; i < length; ++i) {
+        int16_t byteval = input_callback(input_state);
+        if (byteval < 0) {
+            return false;
+        }
+        buffer[i] = byteval;
+    }
+    return true;
+}
+
+// Splits packed pixels into one palette index per byte -- bits_per_pixel is a constant at each call site so the inner loop unrolls
+static inline __attribute__((always_inline)) void qp_internal_unpack_indices(const uint8_t* packed, uint32_t byte_count, uint8_t* indices, uint8_t bits_per_pixel) {
+    const uint8_t pixel_bitmask   = (1 << bits_per_pixel) - 1;
+    const uint8_t pixels_per_byte = 8 / bits_per_pixel;
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        uint8_t byteval = packed[i];
+        for (uint8_t q = 0; q < pixels_per_byte; ++q) {
+            *indices++ = byteval & pixel_bitmask;
+            byteval >>= bits_per_pixel;
+        }
+    }
+}
+
+static bool qp_internal_decode_palette_block(qp_internal_byte_input_callback input_callback, void* input_state, uint8_t bits_per_pixel, uint8_t* indices, uint32_t pixel_count) {
+    const uint8_t pixels_per_byte = 8 / bits_per_pixel;
+    uint32_t      byte_count      = (pixel_count + pixels_per_byte - 1) / pixels_per_byte;
+
+    // 8bpp data is already one index per byte
+    if (bits_per_pixel == 8) {
+        return qp_internal_read_block(input_callback, input_state, indices, byte_count);
+    }
+
+    uint8_t packed[QUANTUM_PAINTER_DECODE_BLOCK_PIXELS / 2];
+    if (!qp_internal_read_block(input_callback, input_state, packed, byte_count)) {
+        return false;
+    }
+
+    switch (bits_per_pixel) {
+        case 1:
+            qp_internal_unpack_indices(packed, byte_count, indices, 1);
+            break;
+        case 2:
+            qp_internal_unpack_indices(packed, byte_count, indices, 2);
+            break;
+        case 4:
+            qp_internal_unpack_indices(packed, byte_count, indices, 4);
+            break;
+        default:
+            qp_dprintf("qp_internal_decode_palette_block: unsupported bpp (%d)\n", (int)bits_per_pixel);
+            return false;
+    }
+    return true;
+}
+
+static bool qp_internal_append_palette_blocks(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
+    painter_driver_t* driver          = (painter_driver_t*)device;
+    uint32_t          max_pixels      = qp_internal_num_pixels_in_buffer(device);
+    uint32_t          pixel_write_pos = 0;
+    uint32_t          remaining       = pixel_count;
+    uint8_t           indices[QUANTUM_PAINTER_DECODE_BLOCK_PIXELS];
+
+    while (remaining > 0) {
+        uint32_t block_pixels = remaining < QUANTUM_PAINTER_DECODE_BLOCK_PIXELS ? remaining : QUANTUM_PAINTER_DECODE_BLOCK_PIXELS;
+        if (!qp_internal_decode_palette_block(input_callback, input_state, bpp, indices, block_pixels)) {
+            return false;
+        }
+        remaining -= block_pixels;
+
+        // Hand the block to the driver in as few calls as the pixdata buffer allows
+        uint32_t offset = 0;
+        while (offset < block_pixels) {
+            uint32_t count = block_pixels - offset;
+            if (count > max_pixels - pixel_write_pos) {
+                count = max_pixels - pixel_write_pos;
+            }
+            if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, pixel_write_pos, count, &indices[offset])) {
+                return false;
+            }
+            offset += count;
+            pixel_write_pos += count;
+
+            // If we've hit the transmit limit, send out the entire buffer and reset the write position
+            if (pixel_write_pos == max_pixels) {
+                if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, pixel_write_pos)) {
+                    return false;
+                }
+                pixel_write_pos = 0;
+            }
+        }
+    }
+
+    // Any leftovers need transmission as well.
+    if (pixel_write_pos > 0) {
+        return driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, pixel_write_pos);
+    }
+    return true;
+}
+
+static bool qp_internal_append_native_blocks(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_state) {
+    painter_driver_t* driver         = (painter_driver_t*)device;
+    uint32_t          max_bytes      = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8;
+    uint32_t          byte_write_pos = 0;
+    uint32_t          remaining      = byte_count;
+    uint8_t           block[QUANTUM_PAINTER_DECODE_BLOCK_PIXELS];
+
+    while (remaining > 0) {
+        uint32_t block_bytes = remaining < sizeof(block) ? remaining : sizeof(block);
+        if (!qp_internal_read_block(input_callback, input_state, block, block_bytes)) {
+            return false;
+        }
+        remaining -= block_bytes;
 
-    bool ret = false;
+        for (uint32_t i = 0; i < block_bytes; ++i) {
+            if (!driver->driver_vtable->append_pixdata(device, qp_internal_global_pixdata_buffer, byte_write_pos++, block[i])) {
+                return false;
+            }
+
+            // If we've hit the transmit limit, send out the entire buffer and reset the write position
+            if (byte_write_pos == max_bytes) {
+                if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+                    return false;
+                }
+                byte_write_pos = 0;
+            }
+        }
+    }
+
+    // Any leftovers need transmission as well.
+    if (byte_write_pos > 0) {
+        return driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, byte_write_pos * 8 / driver->native_bits_per_pixel);
+    }
+    return true;
+}
+
+// Decodes pixel data in the display's native format into the supplied buffer, without sending anything to the display
+bool qp_internal_decode_to_buffer(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state, uint8_t* target_buffer) {
+    painter_driver_t* driver = (painter_driver_t*)device;
 
     // Non-native pixel format
     if (bpp <= 8) {
-        // Set up the output state
-        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
-
-        // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
-        // Any leftovers need transmission as well.
-        if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+        uint8_t indices[QUANTUM_PAINTER_DECODE_BLOCK_PIXELS];
+        for (uint32_t offset = 0; offset < pixel_count;) {
+            uint32_t block_pixels = pixel_count - offset;
+            if (block_pixels > QUANTUM_PAINTER_DECODE_BLOCK_PIXELS) {
+                block_pixels = QUANTUM_PAINTER_DECODE_BLOCK_PIXELS;
+            }
+            if (!qp_internal_decode_palette_block(input_callback, input_state, bpp, indices, block_pixels)) {
+                return false;
+            }
+            if (!driver->driver_vtable->append_pixels(device, target_buffer, qp_internal_global_pixel_lookup_table, offset, block_pixels, indices)) {
+                return false;
+            }
+            offset += block_pixels;
         }
+        return true;
     }
 
     // Native pixel format
-    else if (bpp != driver->native_bits_per_pixel) {
+    if (bpp != driver->native_bits_per_pixel) {
         qp_dprintf("Asset's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", bpp, driver->native_bits_per_pixel);
         return false;
-    } else {
-        // Set up the output state
-        qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
+    }
 
-        // Stream the raw pixel data to the display
-        uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
-        // Any leftovers need transmission as well.
-        if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+    uint32_t byte_count = pixel_count * bpp / 8;
+    uint8_t  block[QUANTUM_PAINTER_DECODE_BLOCK_PIXELS];
+    for (uint32_t offset = 0; offset < byte_count;) {
+        uint32_t block_bytes = byte_count - offset;
+        if (block_bytes > sizeof(block)) {
+            block_bytes = sizeof(block);
         }
+        if (!qp_internal_read_block(input_callback, input_state, block, block_bytes)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < block_bytes; ++i) {
+            if (!driver->driver_vtable->append_pixdata(device, target_buffer, offset++, block[i])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Helper shared between image and font rendering -- decodes the asset a block at a time and sends it to the display, either as palette indices or as native pixel data based on the asset's native-ness
+bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
+    painter_driver_t* driver = (painter_driver_t*)device;
+
+    // Non-native pixel format
+    if (bpp <= 8) {
+        return qp_internal_append_palette_blocks(device, bpp, pixel_count, input_callback, input_state);
+    }
+
+    // Native pixel format
+    if (bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Asset's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", bpp, driver->native_bits_per_pixel);
+        return false;
     }
 
-    return ret;
+    return qp_internal_append_native_blocks(device, pixel_count * bpp / 8, input_callback, input_state);
 }
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
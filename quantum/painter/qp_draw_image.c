@@ -19,6 +19,9 @@ typedef struct qgf_image_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef QP_STREAM_HAS_FLASH
+        qp_flash_stream_t flash_stream;
+#endif // QP_STREAM_HAS_FLASH
     };
 } qgf_image_handle_t;
 
@@ -85,6 +88,30 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef QP_STREAM_HAS_FLASH
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+static inline bool image_flash_stream_factory(qgf_image_handle_t *image, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the graphics descriptor
+    image->flash_stream = qp_make_flash_stream(address, sizeof(qgf_graphics_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    image->flash_stream.length   = qgf_get_total_size(&image->stream);
+    image->flash_stream.position = 0;
+
+    return image->flash_stream.length > 0;
+}
+
+painter_image_handle_t qp_load_image_flash(uint32_t address) {
+    return qp_load_image_internal(image_flash_stream_factory, &address);
+}
+
+#endif // QP_STREAM_HAS_FLASH
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
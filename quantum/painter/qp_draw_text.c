@@ -27,6 +27,9 @@ typedef struct qff_font_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef QP_STREAM_HAS_FLASH
+        qp_flash_stream_t flash_stream;
+#endif // QP_STREAM_HAS_FLASH
     };
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     bool  owns_buffer;
@@ -36,6 +39,82 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+// A glyph decoded into the native pixel format of a specific display, using specific colors
+typedef struct qp_glyph_cache_entry_t {
+    painter_device_t         device; // NULL if the entry is unused
+    const qff_font_handle_t *font;
+    uint32_t                 code_point;
+    qp_pixel_t               fg_hsv888; // only used as part of the key for fonts without a palette
+    qp_pixel_t               bg_hsv888;
+    uint32_t                 last_used;
+    uint8_t                  width;
+    uint8_t                  pixels[QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint32_t               glyph_cache_clock                                = 0;
+
+static inline bool qp_glyph_cache_colors_match(const qp_glyph_cache_entry_t *entry, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    return entry->font->has_palette || (memcmp(&entry->fg_hsv888.hsv888, &fg_hsv888.hsv888, sizeof(fg_hsv888.hsv888)) == 0 && memcmp(&entry->bg_hsv888.hsv888, &bg_hsv888.hsv888, sizeof(bg_hsv888.hsv888)) == 0);
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(painter_device_t device, const qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->device == device && entry->font == qff_font && entry->code_point == code_point && qp_glyph_cache_colors_match(entry, fg_hsv888, bg_hsv888)) {
+            entry->last_used = ++glyph_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Any cached copy of the glyph knows its width, regardless of the display or colors it was decoded for
+static bool qp_glyph_cache_find_width(const qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        const qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->device != NULL && entry->font == qff_font && entry->code_point == code_point) {
+            *width = entry->width;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Claims the least recently used entry for a new glyph, the caller is responsible for filling in the pixel data
+static qp_glyph_cache_entry_t *qp_glyph_cache_insert(painter_device_t device, const qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    qp_glyph_cache_entry_t *victim = &glyph_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES && victim->device != NULL; ++i) {
+        if (glyph_cache[i].device == NULL || glyph_cache[i].last_used < victim->last_used) {
+            victim = &glyph_cache[i];
+        }
+    }
+
+    victim->device     = device;
+    victim->font       = qff_font;
+    victim->code_point = code_point;
+    victim->fg_hsv888  = fg_hsv888;
+    victim->bg_hsv888  = bg_hsv888;
+    victim->width      = width;
+    victim->last_used  = ++glyph_cache_clock;
+    return victim;
+}
+
+static void qp_glyph_cache_invalidate_font(const qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].device = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -73,13 +152,18 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     font->owns_buffer = false;
     font->buffer      = NULL;
 
-    void *ram_buffer = malloc(font->mem_stream.length);
+    // Works out the length for any kind of stream, including external flash
+    qp_stream_seek(&font->stream, 0, SEEK_END);
+    int32_t length = qp_stream_tell(&font->stream);
+    qp_stream_setpos(&font->stream, 0);
+
+    void *ram_buffer = malloc(length);
     if (ram_buffer == NULL) {
         qp_dprintf("qp_load_font: could not allocate enough RAM for font, falling back to original\n");
     } else {
         do {
             // Copy the data into RAM
-            if (qp_stream_read(ram_buffer, 1, font->mem_stream.length, &font->mem_stream) != font->mem_stream.length) {
+            if (qp_stream_read(ram_buffer, 1, length, &font->stream) != (uint32_t)length) {
                 qp_dprintf("qp_load_font: could not copy from flash to RAM, falling back to original\n");
                 break;
             }
@@ -87,7 +171,7 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
             // Create the new stream with the new buffer
             font->buffer      = ram_buffer;
             font->owns_buffer = true;
-            font->mem_stream  = qp_make_memory_stream(font->buffer, font->mem_stream.length);
+            font->mem_stream  = qp_make_memory_stream(font->buffer, length);
         } while (0);
     }
 
@@ -132,6 +216,30 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef QP_STREAM_HAS_FLASH
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash
+
+static inline bool font_flash_stream_factory(qff_font_handle_t *font, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the font descriptor
+    font->flash_stream = qp_make_flash_stream(address, sizeof(qff_font_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    font->flash_stream.length   = qff_get_total_size(&font->stream);
+    font->flash_stream.position = 0;
+
+    return font->flash_stream.length > 0;
+}
+
+painter_font_handle_t qp_load_font_flash(uint32_t address) {
+    return qp_load_font_internal(font_flash_stream_factory, &address);
+}
+
+#endif // QP_STREAM_HAS_FLASH
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -151,6 +259,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Cached glyphs would otherwise be reused by the next font loaded into this slot
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -292,6 +405,19 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     return false;
 }
 
+// Finds the width of a glyph, from the glyph cache if possible. The stream is only left positioned at the glyph's pixel data if *positioned is set.
+static inline bool qp_drawtext_lookup_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, bool *positioned) {
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    if (qp_glyph_cache_find_width(qff_font, code_point, width)) {
+        *positioned = false;
+        return true;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+    *positioned = true;
+    return qp_drawtext_prepare_glyph_for_render(qff_font, code_point, width);
+}
+
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
 static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
     while (*str) {
@@ -303,7 +429,8 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
         }
 
         uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        bool    positioned;
+        if (!qp_drawtext_lookup_glyph(qff_font, code_point, &width, &positioned)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
@@ -337,36 +464,149 @@ static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_f
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // String drawing implementation
 
-// Callback state
-typedef struct code_point_iter_drawglyph_state_t {
-    painter_device_t                  device;
-    int16_t                           xpos;
-    int16_t                           ypos;
-    qp_internal_byte_input_callback   input_callback;
-    qp_internal_byte_input_state_t *  input_state;
-    qp_internal_pixel_output_state_t *output_state;
-} code_point_iter_drawglyph_state_t;
-
-// Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
-    code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
-    painter_driver_t *                 driver = (painter_driver_t *)state->device;
-
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
-
-    // Reset the output state
-    state->output_state->pixel_write_pos = 0;
+// Drawing state, shared by every glyph in the string
+typedef struct qp_drawtext_state_t {
+    painter_device_t                device;
+    qff_font_handle_t *             qff_font;
+    int16_t                         xpos;
+    int16_t                         ypos;
+    qp_pixel_t                      fg_hsv888;
+    qp_pixel_t                      bg_hsv888;
+    bool                            font_prepared; // palette is only set up once a glyph actually needs decoding
+    qp_internal_byte_input_callback input_callback;
+    qp_internal_byte_input_state_t  input_state;
+} qp_drawtext_state_t;
+
+// Draws a single glyph at the current position, from the glyph cache if possible
+static bool qp_drawtext_glyph(qp_drawtext_state_t *state, uint32_t code_point, uint8_t width, bool positioned) {
+    painter_driver_t *driver      = (painter_driver_t *)state->device;
+    uint8_t           height      = state->qff_font->base.line_height;
+    uint32_t          pixel_count = ((uint32_t)width) * height;
 
     // Configure where we're going to be rendering to
-    driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+    if (!driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1)) {
+        return false;
+    }
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(state->device, state->qff_font, code_point, state->fg_hsv888, state->bg_hsv888);
+    if (entry) {
+        return driver->driver_vtable->pixdata(state->device, entry->pixels, pixel_count);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 
-    // Move the x-position for the next glyph
-    state->xpos += width;
+    // Set up the palette the first time a glyph needs decoding; this moves the stream
+    if (!state->font_prepared) {
+        uint32_t data_offset;
+        if (!qp_drawtext_prepare_font_for_render(state->device, state->qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+            qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
+            return false;
+        }
+        state->font_prepared = true;
+        positioned           = false;
+    }
+
+    if (!positioned && !qp_drawtext_prepare_glyph_for_render(state->qff_font, code_point, &width)) {
+        return false;
+    }
+
+    // Reset the input state's RLE mode -- the stream is positioned at the start of the glyph data
+    state->input_state.rle.mode = MARKER_BYTE; // ignored if not using RLE
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Decode into the cache if the glyph fits, then send it from there
+    if ((pixel_count * driver->native_bits_per_pixel + 7) / 8 <= QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE) {
+        entry = qp_glyph_cache_insert(state->device, state->qff_font, code_point, width, state->fg_hsv888, state->bg_hsv888);
+        if (!qp_internal_decode_to_buffer(state->device, state->qff_font->bpp, pixel_count, state->input_callback, &state->input_state, entry->pixels)) {
+            entry->device = NULL;
+            return false;
+        }
+        return driver->driver_vtable->pixdata(state->device, entry->pixels, pixel_count);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 
     // Decode the pixel data for the glyph, and stream it
-    uint32_t pixel_count = ((uint32_t)width) * height;
-    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
+    return qp_internal_appender(state->device, state->qff_font->bpp, pixel_count, state->input_callback, &state->input_state);
+}
+
+// Draws a string, skipping any glyph that matches the glyph drawn at the same position in prev_str (which may be NULL)
+static int16_t qp_drawtext_internal(painter_device_t device, uint16_t x, uint16_t y, qff_font_handle_t *qff_font, const char *str, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, const char *prev_str) {
+    qp_dprintf("qp_drawtext_recolor: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_drawtext_recolor: fail (validation_ok == false)\n");
+        return 0;
+    }
+
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_drawtext_recolor: fail (invalid font)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
+        return 0;
+    }
+
+    // Set up the drawing state, and the byte input state and input callback
+    qp_drawtext_state_t state = {.device = device, .qff_font = qff_font, .xpos = x, .ypos = y, .fg_hsv888 = fg_hsv888, .bg_hsv888 = bg_hsv888, .font_prepared = false, .input_state = {.device = device, .src_stream = &qff_font->stream}};
+    state.input_callback      = qp_internal_prepare_input_state(&state.input_state, qff_font->compression_scheme);
+    if (state.input_callback == NULL) {
+        qp_dprintf("qp_drawtext_recolor: fail (invalid font compression scheme)\n");
+        qp_comms_stop(device);
+        return false;
+    }
+
+    bool    ret       = true;
+    int16_t prev_xpos = x;
+    while (ret && *str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+        if (code_point < 0) {
+            qp_dprintf("Invalid unicode code point decoded. Cannot render.\n");
+            ret = false;
+            break;
+        }
+
+        // Glyphs already on screen at the same position can be skipped
+        if (prev_str && *prev_str) {
+            int32_t prev_code_point = 0;
+            uint8_t prev_width;
+            bool    positioned;
+            prev_str = decode_utf8(prev_str, &prev_code_point);
+            if (prev_code_point < 0 || !qp_drawtext_lookup_glyph(qff_font, prev_code_point, &prev_width, &positioned)) {
+                prev_str = NULL;
+            } else {
+                bool unchanged = prev_code_point == code_point && prev_xpos == state.xpos;
+                prev_xpos += prev_width;
+                if (unchanged) {
+                    state.xpos += prev_width;
+                    continue;
+                }
+            }
+        }
+
+        uint8_t width;
+        bool    positioned;
+        if (!qp_drawtext_lookup_glyph(qff_font, code_point, &width, &positioned)) {
+            qp_dprintf("Failed to prepare glyph for rendering.\n");
+            ret = false;
+            break;
+        }
+
+        if (!qp_drawtext_glyph(&state, code_point, width, positioned)) {
+            qp_dprintf("Failed to draw glyph.\n");
+            ret = false;
+            break;
+        }
+
+        // Move the x-position for the next glyph
+        state.xpos += width;
+    }
+
+    qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
+    qp_comms_stop(device);
+    return ret ? (state.xpos - x) : 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,60 +638,65 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
 // Quantum Painter External API: qp_drawtext_recolor
 
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
-    qp_dprintf("qp_drawtext_recolor: entry\n");
-    painter_driver_t *driver = (painter_driver_t *)device;
-    if (!driver || !driver->validate_ok) {
-        qp_dprintf("qp_drawtext_recolor: fail (validation_ok == false)\n");
-        return 0;
-    }
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    return qp_drawtext_internal(device, x, y, (qff_font_handle_t *)font, str, fg_hsv888, bg_hsv888, NULL);
+}
 
-    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
-    if (!qff_font || !qff_font->validate_ok) {
-        qp_dprintf("qp_drawtext_recolor: fail (invalid font)\n");
-        return false;
-    }
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_textrun_init
+
+void qp_textrun_init(painter_text_run_t *run, painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    memset(run, 0, sizeof(painter_text_run_t));
+    run->device = device;
+    run->font   = font;
+    run->x      = x;
+    run->y      = y;
+    run->hue_fg = hue_fg;
+    run->sat_fg = sat_fg;
+    run->val_fg = val_fg;
+    run->hue_bg = hue_bg;
+    run->sat_bg = sat_bg;
+    run->val_bg = val_bg;
+}
 
-    if (!qp_comms_start(device)) {
-        qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_textrun_update
+
+static int16_t qp_textrun_draw(painter_text_run_t *run, const char *str, const char *prev_str) {
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = run->hue_fg, .s = run->sat_fg, .v = run->val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = run->hue_bg, .s = run->sat_bg, .v = run->val_bg}};
+    int16_t    width     = qp_drawtext_internal(run->device, run->x, run->y, (qff_font_handle_t *)run->font, str, fg_hsv888, bg_hsv888, prev_str);
+    if (width == 0 && *str) {
+        // Unknown what made it to the screen, so redraw everything next time
+        run->text[0] = 0;
         return 0;
     }
 
-    // Set up the byte input state and input callback
-    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
-    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
-    if (input_callback == NULL) {
-        qp_dprintf("qp_drawtext_recolor: fail (invalid font compression scheme)\n");
-        qp_comms_stop(device);
-        return false;
+    // Clear whatever is left of the previous text
+    if (width < run->width) {
+        qp_rect(run->device, run->x + width, run->y, run->x + run->width - 1, run->y + run->font->line_height - 1, run->hue_bg, run->sat_bg, run->val_bg, true);
     }
 
-    // Set up the pixel output state
-    qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
-
-    // Set up the codepoint iteration state
-    code_point_iter_drawglyph_state_t state = {// Common
-                                               .device = device,
-                                               .xpos   = x,
-                                               .ypos   = y,
-                                               // Input
-                                               .input_callback = input_callback,
-                                               .input_state    = &input_state,
-                                               // Output
-                                               .output_state = &output_state};
-
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
-        qp_comms_stop(device);
-        return false;
+    // Remember the new text, unless it doesn't fit -- in which case the next update redraws everything
+    if (strlen(str) < sizeof(run->text)) {
+        if (str != run->text) {
+            strcpy(run->text, str);
+        }
+    } else {
+        run->text[0] = 0;
     }
+    run->width = width;
+    return width;
+}
 
-    // Iterate the codepoints with the drawglyph callback
-    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+int16_t qp_textrun_update(painter_text_run_t *run, const char *str) {
+    return qp_textrun_draw(run, str, run->text);
+}
 
-    qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
-    qp_comms_stop(device);
-    return ret ? (state.xpos - x) : 0;
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_textrun_redraw
+
+int16_t qp_textrun_redraw(painter_text_run_t *run) {
+    return qp_textrun_draw(run, run->text, NULL);
 }
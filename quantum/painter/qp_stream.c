@@ -1,6 +1,7 @@
 // Copyright 2021 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_stream.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -9,6 +10,10 @@
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
     uint8_t *output_ptr = (uint8_t *)output_buf;
 
+    if (stream->read) {
+        return stream->read(stream, output_ptr, num_members * member_size) / member_size;
+    }
+
     uint32_t i;
     for (i = 0; i < (num_members * member_size); ++i) {
         int16_t c = qp_stream_get(stream);
@@ -47,6 +52,18 @@ static inline int16_t mem_get(qp_stream_t *stream) {
     return s->buffer[s->position++];
 }
 
+static inline uint32_t mem_read(qp_stream_t *stream, uint8_t *buf, uint32_t len) {
+    qp_memory_stream_t *s     = (qp_memory_stream_t *)stream;
+    uint32_t            avail = s->position < s->length ? (uint32_t)(s->length - s->position) : 0;
+    if (len > avail) {
+        len       = avail;
+        s->is_eof = true;
+    }
+    memcpy(buf, &s->buffer[s->position], len);
+    s->position += len;
+    return len;
+}
+
 static inline bool mem_put(qp_stream_t *stream, uint8_t c) {
     qp_memory_stream_t *s = (qp_memory_stream_t *)stream;
     if (s->position >= s->length) {
@@ -111,7 +128,7 @@ static inline void mem_close(qp_stream_t *stream) {
 
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     qp_memory_stream_t stream = {
-        .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
+        .base     = {.get = mem_get, .read = mem_read, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
         .buffer   = (uint8_t *)buffer,
         .length   = length,
         .position = 0,
@@ -131,6 +148,11 @@ static inline int16_t file_get(qp_stream_t *stream) {
     return (uint16_t)c;
 }
 
+static inline uint32_t file_read(qp_stream_t *stream, uint8_t *buf, uint32_t len) {
+    qp_file_stream_t *s = (qp_file_stream_t *)stream;
+    return (uint32_t)fread(buf, 1, len, s->file);
+}
+
 static inline bool file_put(qp_stream_t *stream, uint8_t c) {
     qp_file_stream_t *s = (qp_file_stream_t *)stream;
     return fputc(c, s->file) == c;
@@ -158,9 +180,213 @@ static inline void file_close(qp_stream_t *stream) {
 
 qp_file_stream_t qp_make_file_stream(FILE *f) {
     qp_file_stream_t stream = {
-        .base = {.get = file_get, .put = file_put, .seek = file_seek, .tell = file_tell, .is_eof = file_is_eof, .close = file_close},
+        .base = {.get = file_get, .read = file_read, .put = file_put, .seek = file_seek, .tell = file_tell, .is_eof = file_is_eof, .close = file_close},
         .file = f,
     };
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QP_STREAM_HAS_FLASH
+
+#    include "flash.h"
+#    include "qgf.h"
+
+_Static_assert((QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE & (QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1)) == 0, "QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE must be a power of two");
+
+typedef struct qp_flash_cache_block_t {
+    uint32_t address; // block-aligned flash address
+    uint32_t last_used;
+    bool     valid;
+    uint8_t  data[QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE];
+} qp_flash_cache_block_t;
+
+static qp_flash_cache_block_t flash_cache[QUANTUM_PAINTER_FLASH_CACHE_BLOCKS] = {0};
+static qp_flash_cache_block_t *flash_cache_mru                                = NULL;
+static uint32_t                flash_cache_clock                              = 0;
+
+void qp_flash_stream_invalidate_cache(void) {
+    for (int i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_BLOCKS; ++i) {
+        flash_cache[i].valid = false;
+    }
+    flash_cache_mru = NULL;
+}
+
+static qp_flash_cache_block_t *flash_cache_find(uint32_t block_address) {
+    // Streams are mostly read sequentially, so check the most recently used block first
+    if (flash_cache_mru && flash_cache_mru->valid && flash_cache_mru->address == block_address) {
+        return flash_cache_mru;
+    }
+    for (int i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_BLOCKS; ++i) {
+        if (flash_cache[i].valid && flash_cache[i].address == block_address) {
+            flash_cache_mru            = &flash_cache[i];
+            flash_cache_mru->last_used = ++flash_cache_clock;
+            return flash_cache_mru;
+        }
+    }
+    return NULL;
+}
+
+// Returns the cached copy of the block, fetching it from flash into the least recently used slot if required
+static qp_flash_cache_block_t *flash_cache_fetch(uint32_t block_address) {
+    qp_flash_cache_block_t *block = flash_cache_find(block_address);
+    if (block) {
+        return block;
+    }
+
+    block = &flash_cache[0];
+    for (int i = 1; i < QUANTUM_PAINTER_FLASH_CACHE_BLOCKS && block->valid; ++i) {
+        if (!flash_cache[i].valid || flash_cache[i].last_used < block->last_used) {
+            block = &flash_cache[i];
+        }
+    }
+
+    block->valid = flash_read_range(block_address, block->data, QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE) == FLASH_STATUS_SUCCESS;
+    if (!block->valid) {
+        return NULL;
+    }
+    block->address   = block_address;
+    block->last_used = ++flash_cache_clock;
+    flash_cache_mru  = block;
+    return block;
+}
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    uint32_t                address = s->address + s->position;
+    qp_flash_cache_block_t *block   = flash_cache_fetch(address & ~(QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1));
+    if (!block) {
+        return STREAM_EOF;
+    }
+    s->position++;
+    return block->data[address & (QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1)];
+}
+
+static uint32_t flash_read(qp_stream_t *stream, uint8_t *buf, uint32_t len) {
+    qp_flash_stream_t *s     = (qp_flash_stream_t *)stream;
+    uint32_t           avail = s->position < s->length ? (uint32_t)(s->length - s->position) : 0;
+    if (len > avail) {
+        len       = avail;
+        s->is_eof = true;
+    }
+
+    uint32_t done = 0;
+    while (done < len) {
+        uint32_t address = s->address + s->position;
+        uint32_t offset  = address & (QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1);
+        uint32_t count;
+
+        qp_flash_cache_block_t *block = flash_cache_find(address - offset);
+        if (!block && offset == 0 && len - done >= QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE) {
+            // Whole uncached blocks go straight to the caller in one transfer, without evicting hot blocks
+            count = (len - done) & ~(QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1);
+            if (flash_read_range(address, &buf[done], count) != FLASH_STATUS_SUCCESS) {
+                break;
+            }
+        } else {
+            if (!block) {
+                block = flash_cache_fetch(address - offset);
+                if (!block) {
+                    break;
+                }
+            }
+            count = QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - offset;
+            if (count > len - done) {
+                count = len - done;
+            }
+            memcpy(&buf[done], &block->data[offset], count);
+        }
+
+        done += count;
+        s->position += count;
+    }
+    return done;
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    return false; // Read-only.
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // Same bounds as memory streams -- positions past the end are rejected
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .read = flash_read, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+// QGF and QFF files share the same descriptor layout up to the file size, which lets the assets be walked without knowing their type
+uint32_t qp_flash_asset_address(uint16_t index) {
+    uint32_t address = QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS;
+    while (true) {
+        qgf_graphics_descriptor_v1_t descriptor;
+        if (flash_read_range(address, &descriptor, sizeof(descriptor)) != FLASH_STATUS_SUCCESS) {
+            return QP_FLASH_ASSET_NOT_FOUND;
+        }
+
+        // Erased flash fails this check, marking the end of the assets
+        if (descriptor.header.type_id != QGF_GRAPHICS_DESCRIPTOR_TYPEID || descriptor.neg_total_file_size != ~descriptor.total_file_size || descriptor.total_file_size == 0) {
+            return QP_FLASH_ASSET_NOT_FOUND;
+        }
+
+        if (index-- == 0) {
+            return address;
+        }
+        address += descriptor.total_file_size;
+    }
+}
+
+#endif // QP_STREAM_HAS_FLASH
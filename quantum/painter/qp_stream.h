@@ -50,6 +50,7 @@ uint32_t qp_stream_write_impl(const void *input_buf, uint32_t member_size, uint3
 
 typedef struct qp_stream_t {
     int16_t (*get)(qp_stream_t *stream);
+    uint32_t (*read)(qp_stream_t *stream, uint8_t *buf, uint32_t len); // optional, copies a run of bytes in one call
     bool (*put)(qp_stream_t *stream, uint8_t c);
     int (*seek)(qp_stream_t *stream, int32_t offset, int origin);
     int32_t (*tell)(qp_stream_t *stream);
@@ -83,3 +84,25 @@ typedef struct qp_file_stream_t {
 qp_file_stream_t qp_make_file_stream(FILE *f);
 
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#if defined(FLASH_ENABLE) && !defined(QP_STREAM_HAS_FLASH)
+#    define QP_STREAM_HAS_FLASH
+#endif // defined(FLASH_ENABLE) && !defined(QP_STREAM_HAS_FLASH)
+
+#ifdef QP_STREAM_HAS_FLASH
+
+// Read-only stream over data stored in external flash, fetched through a block cache shared by all flash streams
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address; // location of the start of the stream in flash
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+} qp_flash_stream_t;
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+#endif // QP_STREAM_HAS_FLASH
@@ -18,6 +18,7 @@
 #include "quantum.h"
 #include "action_util.h"
 #include "timer.h"
+#include "deadline_scheduler.h"
 #include "keycodes.h"
 
 #ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
@@ -308,17 +309,22 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
  */
 void autoshift_matrix_scan(void) {
     if (autoshift_flags.in_progress) {
-        const uint16_t now = timer_read();
-        if (TIMER_DIFF_16(now, autoshift_time) >=
+        const uint16_t now     = timer_read();
+        const uint16_t elapsed = TIMER_DIFF_16(now, autoshift_time);
+        const uint16_t timeout =
 #ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
-            get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+            get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord);
 #else
-            autoshift_timeout
+            autoshift_timeout;
 #endif
-        ) {
+        if (elapsed >= timeout) {
             autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
+        } else {
+            deadline_set(DEADLINE_AUTO_SHIFT, timeout - elapsed);
+            return;
         }
     }
+    deadline_clear(DEADLINE_AUTO_SHIFT);
 }
 
 void autoshift_toggle(void) {
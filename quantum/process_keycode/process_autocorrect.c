@@ -19,6 +19,20 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+#ifndef AUTOCORRECT_TRIE_FORMAT
+#    define AUTOCORRECT_TRIE_FORMAT 1
+#endif
+
+#ifndef AUTOCORRECT_LINK_SIZE
+#    define AUTOCORRECT_LINK_SIZE 2
+#endif
+
+#if AUTOCORRECT_LINK_SIZE > 2
+typedef uint32_t autocorrect_offset_t;
+#else
+typedef uint16_t autocorrect_offset_t;
+#endif
+
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
@@ -189,6 +203,145 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#if AUTOCORRECT_TRIE_FORMAT == 2
+#    define AUTOCORRECT_NODE_MASK 0xC0
+#    define AUTOCORRECT_NODE_CHAIN 0x00
+#    define AUTOCORRECT_NODE_BRANCH 0x40
+#    define AUTOCORRECT_NODE_LEAF 0x80
+#    define AUTOCORRECT_NODE_CHAIN_LINKED 0xC0
+
+static autocorrect_offset_t autocorrect_read_link(autocorrect_offset_t offset) {
+    autocorrect_offset_t link = pgm_read_byte(autocorrect_data + offset) | pgm_read_byte(autocorrect_data + offset + 1) << 8;
+#    if AUTOCORRECT_LINK_SIZE > 2
+    link |= (autocorrect_offset_t)pgm_read_byte(autocorrect_data + offset + 2) << 16;
+#    endif
+    return link;
+}
+
+/**
+ * @brief finds the child of a branch node for a keycode
+ *
+ * @param state offset of the branch node
+ * @param count number of listed children, 0 if the node has a child bitmap
+ * @param keycode keycode to look up
+ * @return offset of the child node, 0 if there is none
+ */
+static autocorrect_offset_t autocorrect_find_child(autocorrect_offset_t state, uint8_t count, uint8_t keycode) {
+    if (count) {
+        // A few children, listed as keycode and link
+        for (++state; count; --count, state += 1 + AUTOCORRECT_LINK_SIZE) {
+            if (pgm_read_byte(autocorrect_data + state) == keycode) {
+                return autocorrect_read_link(state + 1);
+            }
+        }
+        return 0;
+    }
+
+    // A bitmap of the children in keycode order, a-z, space and quote, followed by their links
+    uint8_t symbol = keycode == KC_SPC ? 26 : keycode == KC_QUOTE ? 27 : keycode - KC_A;
+    uint8_t bits   = pgm_read_byte(autocorrect_data + state + 1 + symbol / 8);
+    if (!(bits & (1 << (symbol % 8)))) {
+        return 0;
+    }
+
+    uint8_t index = __builtin_popcount(bits & ((1 << (symbol % 8)) - 1));
+    for (uint8_t i = 0; i < symbol / 8; ++i) {
+        index += __builtin_popcount(pgm_read_byte(autocorrect_data + state + 1 + i));
+    }
+    return autocorrect_read_link(state + 5 + index * AUTOCORRECT_LINK_SIZE);
+}
+
+/**
+ * @brief walks the trie with the typo buffer, newest keycode first
+ *
+ * Every keycode takes one chain comparison or one branch lookup, whatever
+ * the number of siblings.
+ *
+ * @return offset of the leaf of the typo found, 0 if there is none
+ */
+static autocorrect_offset_t autocorrect_find_typo(void) {
+    autocorrect_offset_t state        = 0;
+    uint8_t              chain_length = 0; // keycodes left in the current chain node
+    bool                 chain_linked = false;
+
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = typo_buffer[i];
+        uint8_t       code  = pgm_read_byte(autocorrect_data + state);
+
+        if (chain_length == 0 && (code & AUTOCORRECT_NODE_MASK) == AUTOCORRECT_NODE_BRANCH) {
+            if (!(state = autocorrect_find_child(state, code & 63, key_i))) {
+                return 0;
+            }
+        } else {
+            if (chain_length == 0) { // Enter a chain node.
+                chain_length = code & 63;
+                chain_linked = (code & AUTOCORRECT_NODE_MASK) == AUTOCORRECT_NODE_CHAIN_LINKED;
+                code         = pgm_read_byte(autocorrect_data + (++state));
+            }
+            if (code != key_i) {
+                return 0;
+            }
+            ++state;
+            // At the end of the chain, the child follows directly or is linked.
+            if (--chain_length == 0 && chain_linked) {
+                state = autocorrect_read_link(state);
+            }
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return 0;
+        }
+
+        if (chain_length == 0 && (pgm_read_byte(autocorrect_data + state) & AUTOCORRECT_NODE_MASK) == AUTOCORRECT_NODE_LEAF) {
+            return state;
+        }
+    }
+    return 0;
+}
+#else
+/**
+ * @brief walks the trie with the typo buffer, newest keycode first
+ *
+ * @return offset of the leaf of the typo found, 0 if there is none
+ */
+static autocorrect_offset_t autocorrect_find_typo(void) {
+    uint16_t state = 0;
+    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = typo_buffer[i];
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) return 0;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return 0;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return 0;
+        }
+
+        code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // A typo was found!
+            return state;
+        }
+    }
+    return 0;
+}
+#endif
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -280,97 +433,73 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
+    autocorrect_offset_t state = autocorrect_find_typo();
+    if (!state) {
+        return true;
+    }
 
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
+    // A typo was found! Apply autocorrect.
+    const uint8_t code       = pgm_read_byte(autocorrect_data + state);
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
+        ++typo_len;
+    }
 
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
 
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
         }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
     }
-    return true;
 }
@@ -16,9 +16,12 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
+#include "deadline_scheduler.h"
 #include "wait.h"
 #include "keyboard.h"
 #include "keymap_common.h"
@@ -102,6 +105,30 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_INDEX_LENGTH
+/* Inverted index from keycode to the combos containing it, sorted by keycode
+ * and then by combo index so candidates are visited in the same order as the
+ * linear scan. Built lazily from combo_get()/combo_count() on first use. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index;
+    uint8_t  key_count;
+} combo_index_entry_t;
+
+typedef enum { COMBO_INDEX_STALE, COMBO_INDEX_READY, COMBO_INDEX_OVERFLOW } combo_index_state_t;
+
+static combo_index_entry_t combo_index_entries[COMBO_INDEX_LENGTH];
+static uint16_t            combo_index_size  = 0;
+static combo_index_state_t combo_index_state = COMBO_INDEX_STALE;
+
+/* Combos whose state may be non-zero, so clear_combos() only visits those. A
+ * built index holds at least one entry per combo, which bounds the combo count. */
+static uint8_t combo_index_touched[(COMBO_INDEX_LENGTH + 7) / 8];
+
+#    define COMBO_INDEX_TOUCH(combo_index) (combo_index_touched[(combo_index) / 8] |= (1 << ((combo_index) % 8)))
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -202,6 +229,28 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_INDEX_LENGTH
+    if (combo_index_state == COMBO_INDEX_READY) {
+        uint16_t count = combo_count();
+        for (uint16_t byte = 0; byte < sizeof(combo_index_touched); ++byte) {
+            for (uint8_t bit = 0; combo_index_touched[byte] && bit < 8; ++bit) {
+                if (!(combo_index_touched[byte] & (1 << bit))) {
+                    continue;
+                }
+                index = byte * 8 + bit;
+                if (index < count) {
+                    combo_t *combo = combo_get(index);
+                    if (COMBO_ACTIVE(combo)) {
+                        continue;
+                    }
+                    RESET_COMBO_STATE(combo);
+                }
+                combo_index_touched[byte] &= ~(1 << bit);
+            }
+        }
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -264,7 +313,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -286,6 +334,83 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_INDEX_LENGTH
+static int combo_index_compare(const void *a, const void *b) {
+    const combo_index_entry_t *entry_a = a;
+    const combo_index_entry_t *entry_b = b;
+
+    if (entry_a->keycode != entry_b->keycode) {
+        return entry_a->keycode < entry_b->keycode ? -1 : 1;
+    }
+    return entry_a->combo_index < entry_b->combo_index ? -1 : (entry_a->combo_index > entry_b->combo_index);
+}
+
+static void combo_index_build(void) {
+    uint16_t count = combo_count();
+
+    combo_index_size  = 0;
+    combo_index_state = COMBO_INDEX_OVERFLOW;
+    // states may be left over from before the rebuild, let the next clear visit everything
+    memset(combo_index_touched, 0xFF, sizeof(combo_index_touched));
+
+    if (count > COMBO_INDEX_LENGTH) {
+        return;
+    }
+
+    for (uint16_t idx = 0; idx < count; ++idx) {
+        const uint16_t *keys      = combo_get(idx)->keys;
+        uint16_t        first     = combo_index_size;
+        uint8_t         key_count = 0;
+        uint16_t        key;
+
+        while ((key = pgm_read_word(&keys[key_count])) != COMBO_END) {
+            // a keycode listed twice maps to its last position, like _find_key_index_and_count()
+            uint16_t i = first;
+            while (i < combo_index_size && combo_index_entries[i].keycode != key) {
+                i++;
+            }
+            if (i == combo_index_size) {
+                if (combo_index_size == COMBO_INDEX_LENGTH) {
+                    return;
+                }
+                combo_index_size++;
+            }
+            combo_index_entries[i] = (combo_index_entry_t){
+                .keycode     = key,
+                .combo_index = idx,
+                .key_index   = key_count,
+            };
+            key_count++;
+        }
+
+        for (uint16_t i = first; i < combo_index_size; i++) {
+            combo_index_entries[i].key_count = key_count;
+        }
+    }
+
+    qsort(combo_index_entries, combo_index_size, sizeof(combo_index_entry_t), combo_index_compare);
+    combo_index_state = COMBO_INDEX_READY;
+}
+
+static uint16_t combo_index_find(uint16_t keycode) {
+    // lower bound, the first entry for the keycode if there is one
+    uint16_t low = 0, high = combo_index_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_index_entries[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void combo_index_invalidate(void) {
+    combo_index_state = COMBO_INDEX_STALE;
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -422,16 +547,7 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return COMBO_KEY_NOT_PRESSED;
-    }
-
+static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -552,8 +668,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +696,35 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_LENGTH
+    if (combo_index_state == COMBO_INDEX_STALE) {
+        combo_index_build();
+    }
+
+    if (combo_index_state == COMBO_INDEX_READY) {
+        for (uint16_t i = combo_index_find(keycode); i < combo_index_size && combo_index_entries[i].keycode == keycode; ++i) {
+            const combo_index_entry_t *entry = &combo_index_entries[i];
+
+            is_combo_key |= process_single_combo(combo_get(entry->combo_index), keycode, record, entry->combo_index, entry->key_index, entry->key_count);
+            // marked afterwards, processing may have cleared combos in the meantime
+            COMBO_INDEX_TOUCH(entry->combo_index);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo     = combo_get(idx);
+            uint8_t  key_count = 0;
+            uint16_t key_index = -1;
+            _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+            /* Continue processing if key isn't part of current combo. */
+            if (-1 == (int16_t)key_index) {
+                continue;
+            }
+
+            is_combo_key |= process_single_combo(combo, keycode, record, idx, key_index, key_count);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -597,6 +737,8 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #    else
         timer = timer_read();
 #    endif
+        // Combos run before process_record_quantum() wakes the other features
+        deadline_wake(DEADLINE_COMBO);
 #endif
 
 #ifdef COMBO_PROCESS_KEY_REPRESS
@@ -629,6 +771,7 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 
 void combo_task(void) {
     if (!b_combo_enable) {
+        deadline_clear(DEADLINE_COMBO);
         return;
     }
 
@@ -644,11 +787,21 @@ void combo_task(void) {
             clear_combos();
         }
     }
+
+    if (timer) {
+        uint16_t elapsed = timer_elapsed(timer);
+        deadline_set(DEADLINE_COMBO, elapsed > longest_term ? 0 : longest_term + 1 - elapsed);
+    } else {
+        deadline_clear(DEADLINE_COMBO);
+    }
+#else
+    deadline_clear(DEADLINE_COMBO);
 #endif
 }
 
 void combo_enable(void) {
     b_combo_enable = true;
+    deadline_wake(DEADLINE_COMBO);
 }
 
 void combo_disable(void) {
@@ -77,6 +77,12 @@ bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+#ifdef COMBO_INDEX_LENGTH
+/* Rebuilds the keycode to combo index on the next key event, call this after
+ * changing the combos returned by combo_get() at runtime. */
+void combo_index_invalidate(void);
+#endif
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
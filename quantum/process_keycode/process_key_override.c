@@ -18,6 +18,7 @@
 #include "process_key_override.h"
 #include "report.h"
 #include "timer.h"
+#include "deadline_scheduler.h"
 #include "debug.h"
 #include "wait.h"
 #include "action_util.h"
@@ -84,6 +85,31 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+// Overrides bucketed by trigger keycode. key_override_index_order holds the override indices grouped by trigger, in override order within each bucket, and the buckets are sorted by trigger. Built lazily from key_override_get()/key_override_count() on first use.
+typedef struct {
+    uint16_t trigger;
+    uint16_t first;
+    uint16_t count;
+    // Mods of which at least one must be down for any override in the bucket to activate, 0 if some override requires none
+    uint8_t required_mods;
+    // Mods that prevent every override in the bucket from activating
+    uint8_t negative_mods;
+} key_override_bucket_t;
+
+typedef struct {
+    uint16_t next;
+    uint16_t end;
+} key_override_range_t;
+
+typedef enum { KEY_OVERRIDE_INDEX_STALE, KEY_OVERRIDE_INDEX_READY, KEY_OVERRIDE_INDEX_OVERFLOW } key_override_index_state_t;
+
+static uint16_t                   key_override_index_order[KEY_OVERRIDE_INDEX_LENGTH];
+static key_override_bucket_t      key_override_buckets[KEY_OVERRIDE_INDEX_LENGTH];
+static uint16_t                   key_override_bucket_count = 0;
+static key_override_index_state_t key_override_index_state  = KEY_OVERRIDE_INDEX_STALE;
+#endif
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -155,6 +181,7 @@ static void schedule_deferred_register(const uint16_t keycode) {
         defer_delay          = 50; // 50ms
     }
     deferred_register = keycode;
+    deadline_wake(DEADLINE_KEY_OVERRIDE);
 }
 
 const key_override_t *clear_active_override(const bool allow_reregister) {
@@ -243,13 +270,20 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+static void key_override_index_build(void) {
+    const uint16_t count = key_override_count();
+    uint16_t       size  = 0;
+
+    key_override_bucket_count = 0;
+    key_override_index_state  = KEY_OVERRIDE_INDEX_OVERFLOW;
+
+    if (count > KEY_OVERRIDE_INDEX_LENGTH) {
+        return;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
+    // Insertion sort by trigger, which keeps each bucket in override order
+    for (uint16_t i = 0; i < count; i++) {
         const key_override_t *const override = key_override_get(i);
 
         // End of array
@@ -257,151 +291,288 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
             break;
         }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
+        uint16_t j = size++;
+        while (j > 0 && key_override_get(key_override_index_order[j - 1])->trigger > override->trigger) {
+            key_override_index_order[j] = key_override_index_order[j - 1];
+            j--;
         }
+        key_override_index_order[j] = i;
+    }
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
+    for (uint16_t i = 0; i < size; i++) {
+        const key_override_t *const override = key_override_get(key_override_index_order[i]);
+
+        if (key_override_bucket_count == 0 || key_override_buckets[key_override_bucket_count - 1].trigger != override->trigger) {
+            key_override_buckets[key_override_bucket_count++] = (key_override_bucket_t){
+                .trigger       = override->trigger,
+                .first         = i,
+                .count         = 0,
+                .required_mods = override->trigger_mods,
+                .negative_mods = override->negative_mod_mask,
+            };
         }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+        key_override_bucket_t *const bucket = &key_override_buckets[key_override_bucket_count - 1];
+
+        bucket->count++;
+        bucket->required_mods = (bucket->required_mods != 0 && override->trigger_mods != 0) ? (bucket->required_mods | override->trigger_mods) : 0;
+        bucket->negative_mods &= override->negative_mod_mask;
+    }
 
-        const bool is_trigger = override->trigger == keycode;
+    key_override_index_state = KEY_OVERRIDE_INDEX_READY;
+}
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
+/** Adds the overrides triggered by `trigger` to `ranges`, unless none of them can activate with `active_mods`. Returns the new number of ranges */
+static uint8_t key_override_index_add_range(key_override_range_t *ranges, uint8_t range_count, const uint16_t trigger, const uint8_t active_mods) {
+    uint16_t low = 0, high = key_override_bucket_count;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (key_override_buckets[mid].trigger < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    if (low == key_override_bucket_count || key_override_buckets[low].trigger != trigger) {
+        return range_count;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    const key_override_bucket_t *const bucket = &key_override_buckets[low];
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    if ((bucket->negative_mods & active_mods) != 0) {
+        key_override_printf("Not activating overrides for trigger %u: Negative modifier down\n", trigger);
+        return range_count;
+    }
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    // Every override in the bucket needs at least one of its trigger mods down, whether or not ko_option_one_mod is set
+    if (bucket->required_mods != 0 && (bucket->required_mods & active_mods) == 0) {
+        key_override_printf("Not activating overrides for trigger %u: Modifiers don't match\n", trigger);
+        return range_count;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    ranges[range_count++] = (key_override_range_t){.next = bucket->first, .end = bucket->first + bucket->count};
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    return range_count;
+}
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+void key_override_index_invalidate(void) {
+    key_override_index_state = KEY_OVERRIDE_INDEX_STALE;
+}
+#endif
 
-        key_override_printf("Activating override\n");
+/** Activates the override if all of its requirements are met by the key event. Returns true if it was activated, in which case `send_key_action` is set to whether the key action for `keycode` should be sent */
+static bool try_activating_single_override(const key_override_t *const override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
+
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
+
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        clear_active_override(false);
+    const bool is_trigger = override->trigger == keycode;
+
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
+
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
+
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
+
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
+
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
+
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
+
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
+
+    key_override_printf("Activating override\n");
+
+    clear_active_override(false);
 
 #ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
 #endif
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    active_override                 = override;
+    active_override_trigger_is_down = true;
+
+    set_suppressed_override_mods(override->suppressed_mods);
+
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
+
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
+
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    *send_key_action = !trigger_down;
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    return true;
+}
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
-        }
+/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    bool send_key_action = true;
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    *activated = false;
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
+    if (key_override_count() == 0) {
+        return true;
+    }
+
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+    if (key_override_index_state == KEY_OVERRIDE_INDEX_STALE) {
+        key_override_index_build();
+    }
+
+    if (key_override_index_state == KEY_OVERRIDE_INDEX_READY) {
+        // Only overrides without a trigger, triggered by the pressed key or by the last non-mod key down can activate. Anything else fails the trigger check of the linear scan.
+        key_override_range_t ranges[3];
+        uint8_t              range_count = key_override_index_add_range(ranges, 0, KC_NO, active_mods);
+
+        if (key_down && keycode != KC_NO) {
+            range_count = key_override_index_add_range(ranges, range_count, keycode, active_mods);
+        }
+        // For non-mod keys the last key down is the pressed key
+        if (is_mod && last_key_down != KC_NO) {
+            range_count = key_override_index_add_range(ranges, range_count, last_key_down, active_mods);
+        }
+
+        // Merge the buckets so candidates are tried in the same order as the linear scan
+        while (true) {
+            key_override_range_t *next = NULL;
+            for (uint8_t r = 0; r < range_count; r++) {
+                if (ranges[r].next < ranges[r].end && (next == NULL || key_override_index_order[ranges[r].next] < key_override_index_order[next->next])) {
+                    next = &ranges[r];
                 }
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+            if (next == NULL) {
+                return true;
+            }
+
+            if (try_activating_single_override(key_override_get(key_override_index_order[next->next++]), keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+                *activated = true;
+                return send_key_action;
+            }
         }
+    }
+#endif
 
-        *activated = true;
+    for (uint8_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
-    }
+        // End of array
+        if (override == NULL) {
+            break;
+        }
 
-    *activated = false;
+        if (try_activating_single_override(override, keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+            *activated = true;
+            return send_key_action;
+        }
+    }
 
     return true;
 }
 
 void key_override_task(void) {
     if (deferred_register == 0) {
+        deadline_clear(DEADLINE_KEY_OVERRIDE);
         return;
     }
 
-    if (timer_elapsed32(defer_reference_time) >= defer_delay) {
+    uint32_t elapsed = timer_elapsed32(defer_reference_time);
+    if (elapsed >= defer_delay) {
         key_override_printf("Registering deferred key\n");
         register_code16(deferred_register);
         deferred_register    = 0;
         defer_reference_time = 0;
         defer_delay          = 0;
+        deadline_clear(DEADLINE_KEY_OVERRIDE);
+    } else {
+        deadline_set(DEADLINE_KEY_OVERRIDE, defer_delay - elapsed);
     }
 }
 
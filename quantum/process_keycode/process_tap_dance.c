@@ -20,6 +20,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "timer.h"
+#include "deadline_scheduler.h"
 #include "wait.h"
 #include "keymap_introspection.h"
 
@@ -186,12 +187,24 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td) {
+        deadline_clear(DEADLINE_TAP_DANCE);
+        return;
+    }
+
+    uint16_t tapping_term = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+    uint16_t elapsed      = timer_elapsed(last_tap_time);
+    if (elapsed <= tapping_term) {
+        deadline_set(DEADLINE_TAP_DANCE, tapping_term + 1 - elapsed);
+        return;
+    }
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     if (!action->state.interrupted) {
         process_tap_dance_action_on_dance_finished(action);
     }
+    // Nothing left to time out until the next tap
+    deadline_clear(DEADLINE_TAP_DANCE);
 }
 
 void reset_tap_dance(tap_dance_state_t *state) {
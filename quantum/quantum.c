@@ -15,6 +15,11 @@
  */
 
 #include "quantum.h"
+#include "deadline_scheduler.h"
+
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
 
 #ifdef BACKLIGHT_ENABLE
 #    include "process_backlight.h"
@@ -210,6 +215,9 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#ifdef EEPROM_DRIVER
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -277,6 +285,9 @@ void post_process_record_quantum(keyrecord_t *record) {
 bool process_record_quantum(keyrecord_t *record) {
     uint16_t keycode = get_record_keycode(record, true);
 
+    // Any key event, including those replayed from the tapping buffer, may start or extend a feature timeout
+    deadline_wake_all();
+
     // This is how you use actions here
     // if (keycode == QK_LEADER) {
     //   action_t action;
@@ -527,6 +538,9 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 
 void suspend_power_down_quantum(void) {
     suspend_power_down_kb();
+#ifdef EEPROM_DRIVER
+    eeprom_driver_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
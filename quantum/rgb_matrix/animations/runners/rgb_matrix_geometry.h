@@ -0,0 +1,46 @@
+#pragma once
+
+// LED positions never change, so RGB_MATRIX_PRECOMPUTED_GEOMETRY and
+// RGB_MATRIX_PRECOMPUTED_LED_DISTANCE fill these in once from rgb_matrix_init()
+// instead of every frame. Without them the values are computed on demand.
+
+static inline uint8_t rgb_matrix_point_dist(led_point_t a, led_point_t b) {
+    int16_t dx = a.x - b.x;
+    int16_t dy = a.y - b.y;
+    return sqrt16(dx * dx + dy * dy);
+}
+
+// Distance of an LED from k_rgb_matrix_center
+static inline uint8_t rgb_matrix_center_dist(uint8_t i) {
+#ifdef RGB_MATRIX_PRECOMPUTED_GEOMETRY
+    return g_rgb_center_dist[i];
+#else
+    return rgb_matrix_point_dist(g_led_config.point[i], k_rgb_matrix_center);
+#endif
+}
+
+// Angle of an LED around k_rgb_matrix_center, as atan2_8(dy, dx)
+static inline uint8_t rgb_matrix_center_angle(uint8_t i) {
+#ifdef RGB_MATRIX_PRECOMPUTED_GEOMETRY
+    return g_rgb_center_angle[i];
+#else
+    return atan2_8(g_led_config.point[i].y - k_rgb_matrix_center.y, g_led_config.point[i].x - k_rgb_matrix_center.x);
+#endif
+}
+
+// Distance between two LEDs
+static inline uint8_t rgb_matrix_led_dist(uint8_t a, uint8_t b) {
+#ifdef RGB_MATRIX_PRECOMPUTED_LED_DISTANCE
+    if (a == b) {
+        return 0;
+    }
+    if (a < b) {
+        uint8_t t = a;
+        a         = b;
+        b         = t;
+    }
+    return g_rgb_led_dist[RGB_MATRIX_LED_DIST_INDEX(a, b)];
+#else
+    return rgb_matrix_point_dist(g_led_config.point[a], g_led_config.point[b]);
+#endif
+}
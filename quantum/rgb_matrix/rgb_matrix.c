@@ -69,6 +69,13 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_PRECOMPUTED_GEOMETRY
+uint8_t g_rgb_center_dist[RGB_MATRIX_LED_COUNT];
+uint8_t g_rgb_center_angle[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_PRECOMPUTED_GEOMETRY
+#ifdef RGB_MATRIX_PRECOMPUTED_LED_DISTANCE
+uint8_t g_rgb_led_dist[RGB_MATRIX_LED_DIST_SIZE];
+#endif // RGB_MATRIX_PRECOMPUTED_LED_DISTANCE
 
 // internals
 static bool            suspend_state     = false;
@@ -77,6 +84,12 @@ static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
 
+// static frame tracking
+static rgb_config_t rgb_frame_config;
+static bool         rgb_frame_unchanged = false;
+static bool         rgb_frame_overdrawn = true;
+static bool         rgb_effect_drawing  = false;
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -153,10 +166,16 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (!rgb_effect_drawing) {
+        rgb_frame_overdrawn = true;
+    }
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    if (!rgb_effect_drawing) {
+        rgb_frame_overdrawn = true;
+    }
 #if defined(RGB_MATRIX_SPLIT)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
@@ -239,6 +258,35 @@ void rgb_matrix_test(void) {
     }
 }
 
+__attribute__((weak)) bool rgb_matrix_effect_is_static_kb(uint8_t mode) {
+    return rgb_matrix_effect_is_static_user(mode);
+}
+
+__attribute__((weak)) bool rgb_matrix_effect_is_static_user(uint8_t mode) {
+    return false;
+}
+
+bool rgb_matrix_effect_is_static(uint8_t mode) {
+    switch (mode) {
+        case RGB_MATRIX_SOLID_COLOR:
+#ifdef ENABLE_RGB_MATRIX_ALPHAS_MODS
+        case RGB_MATRIX_ALPHAS_MODS:
+#endif
+#ifdef ENABLE_RGB_MATRIX_GRADIENT_UP_DOWN
+        case RGB_MATRIX_GRADIENT_UP_DOWN:
+#endif
+#ifdef ENABLE_RGB_MATRIX_GRADIENT_LEFT_RIGHT
+        case RGB_MATRIX_GRADIENT_LEFT_RIGHT:
+#endif
+            return true;
+        case RGB_MATRIX_NONE:
+        case UINT8_MAX:
+            return false;
+        default:
+            return rgb_matrix_effect_is_static_kb(mode);
+    }
+}
+
 static bool rgb_matrix_none(effect_params_t *params) {
     if (!params->init) {
         return false;
@@ -273,10 +321,15 @@ static void rgb_task_sync(void) {
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
 }
 
-static void rgb_task_start(void) {
+static void rgb_task_start(uint8_t effect) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+    // a static effect only needs redrawing if its inputs changed or something else drew over it
+    rgb_frame_unchanged = effect == rgb_last_effect && rgb_matrix_config.enable == rgb_last_enable && rgb_matrix_config.raw == rgb_frame_config.raw && !rgb_frame_overdrawn && rgb_matrix_effect_is_static(effect);
+    rgb_frame_config    = rgb_matrix_config;
+    rgb_frame_overdrawn = false;
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -287,13 +340,8 @@ static void rgb_task_start(void) {
     rgb_task_state = RENDERING;
 }
 
-static void rgb_task_render(uint8_t effect) {
-    bool rendering         = false;
-    rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
-    if (rgb_effect_params.flags != rgb_matrix_config.flags) {
-        rgb_effect_params.flags = rgb_matrix_config.flags;
-        rgb_matrix_set_color_all(0, 0, 0);
-    }
+static bool rgb_task_render_effect(uint8_t effect) {
+    bool rendering = false;
 
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
@@ -328,11 +376,36 @@ static void rgb_task_render(uint8_t effect) {
             // ---------------------------------------------
 
         // Factory default magic value
-        case UINT8_MAX: {
+        case UINT8_MAX:
             rgb_matrix_test();
-            rgb_task_state = FLUSHING;
-        }
-            return;
+            break;
+    }
+
+    return rendering;
+}
+
+static void rgb_task_render(uint8_t effect) {
+    bool rendering         = false;
+    rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
+    if (rgb_effect_params.flags != rgb_matrix_config.flags) {
+        rgb_effect_params.flags = rgb_matrix_config.flags;
+        rgb_matrix_set_color_all(0, 0, 0);
+    }
+
+    if (rgb_frame_unchanged && effect == rgb_last_effect) {
+        // the LEDs still show this frame, only step through the iterations for the indicators
+        RGB_MATRIX_USE_LIMITS_ITER(led_min, led_max, rgb_effect_params.iter);
+        rendering = rgb_matrix_check_finished_leds(led_max);
+    } else {
+        rgb_frame_unchanged = false;
+        rgb_effect_drawing  = true;
+        rendering           = rgb_task_render_effect(effect);
+        rgb_effect_drawing  = false;
+    }
+
+    if (effect == UINT8_MAX) {
+        rgb_task_state = FLUSHING;
+        return;
     }
 
     rgb_effect_params.iter++;
@@ -352,8 +425,10 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
-    // update pwm buffers
-    rgb_matrix_update_pwm_buffers();
+    // update pwm buffers, unless the frame is the same as the last one
+    if (!rgb_frame_unchanged || rgb_frame_overdrawn) {
+        rgb_matrix_update_pwm_buffers();
+    }
 
     // next task
     rgb_task_state = SYNCING;
@@ -374,7 +449,7 @@ void rgb_matrix_task(void) {
 
     switch (rgb_task_state) {
         case STARTING:
-            rgb_task_start();
+            rgb_task_start(effect);
             break;
         case RENDERING:
             rgb_task_render(effect);
@@ -452,8 +527,25 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+static void rgb_matrix_init_geometry(void) {
+#ifdef RGB_MATRIX_PRECOMPUTED_GEOMETRY
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        g_rgb_center_dist[i]  = rgb_matrix_point_dist(g_led_config.point[i], k_rgb_matrix_center);
+        g_rgb_center_angle[i] = atan2_8(g_led_config.point[i].y - k_rgb_matrix_center.y, g_led_config.point[i].x - k_rgb_matrix_center.x);
+    }
+#endif // RGB_MATRIX_PRECOMPUTED_GEOMETRY
+#ifdef RGB_MATRIX_PRECOMPUTED_LED_DISTANCE
+    for (uint8_t a = 1; a < RGB_MATRIX_LED_COUNT; a++) {
+        for (uint8_t b = 0; b < a; b++) {
+            g_rgb_led_dist[RGB_MATRIX_LED_DIST_INDEX(a, b)] = rgb_matrix_point_dist(g_led_config.point[a], g_led_config.point[b]);
+        }
+    }
+#endif // RGB_MATRIX_PRECOMPUTED_LED_DISTANCE
+}
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+    rgb_matrix_init_geometry();
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
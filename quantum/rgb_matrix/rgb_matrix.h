@@ -164,6 +164,12 @@ void rgb_matrix_indicators_advanced(effect_params_t *params);
 bool rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
+// Static effects only depend on rgb_matrix_config, so they are not redrawn
+// or flushed again until the config changes or something draws over them
+bool rgb_matrix_effect_is_static(uint8_t mode);
+bool rgb_matrix_effect_is_static_kb(uint8_t mode);
+bool rgb_matrix_effect_is_static_user(uint8_t mode);
+
 void rgb_matrix_init(void);
 
 void rgb_matrix_reload_from_eeprom(void);
@@ -280,3 +286,13 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_PRECOMPUTED_GEOMETRY
+extern uint8_t g_rgb_center_dist[RGB_MATRIX_LED_COUNT];
+extern uint8_t g_rgb_center_angle[RGB_MATRIX_LED_COUNT];
+#endif
+#ifdef RGB_MATRIX_PRECOMPUTED_LED_DISTANCE
+// Lower triangle of the LED to LED distance matrix, without the diagonal
+#    define RGB_MATRIX_LED_DIST_INDEX(a, b) ((uint16_t)(a) * ((a)-1) / 2 + (b))
+#    define RGB_MATRIX_LED_DIST_SIZE ((uint16_t)RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2)
+extern uint8_t g_rgb_led_dist[RGB_MATRIX_LED_DIST_SIZE];
+#endif
@@ -31,7 +31,7 @@
 #if defined(RGB_MATRIX_IS31FL3218)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3218_init,
-    .flush         = is31fl3218_update_pwm_buffers,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3218_set_color,
     .set_color_all = is31fl3218_set_color_all,
 };
@@ -39,7 +39,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3236)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3236_init_drivers,
-    .flush         = is31fl3236_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3236_set_color,
     .set_color_all = is31fl3236_set_color_all,
 };
@@ -47,7 +47,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3729)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3729_init_drivers,
-    .flush         = is31fl3729_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3729_set_color,
     .set_color_all = is31fl3729_set_color_all,
 };
@@ -55,7 +55,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3731)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3731_init_drivers,
-    .flush         = is31fl3731_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3731_set_color,
     .set_color_all = is31fl3731_set_color_all,
 };
@@ -63,7 +63,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3733)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3733_init_drivers,
-    .flush         = is31fl3733_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
 };
@@ -71,7 +71,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3736)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3736_init_drivers,
-    .flush         = is31fl3736_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3736_set_color,
     .set_color_all = is31fl3736_set_color_all,
 };
@@ -79,7 +79,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3737)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3737_init_drivers,
-    .flush         = is31fl3737_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3737_set_color,
     .set_color_all = is31fl3737_set_color_all,
 };
@@ -87,7 +87,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3741)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3741_init_drivers,
-    .flush         = is31fl3741_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3741_set_color,
     .set_color_all = is31fl3741_set_color_all,
 };
@@ -95,7 +95,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3742A)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3742a_init_drivers,
-    .flush         = is31fl3742a_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3742a_set_color,
     .set_color_all = is31fl3742a_set_color_all,
 };
@@ -103,7 +103,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3743A)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3743a_init_drivers,
-    .flush         = is31fl3743a_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3743a_set_color,
     .set_color_all = is31fl3743a_set_color_all,
 };
@@ -111,7 +111,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3745)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3745_init_drivers,
-    .flush         = is31fl3745_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3745_set_color,
     .set_color_all = is31fl3745_set_color_all,
 };
@@ -119,7 +119,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_IS31FL3746A)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3746a_init_drivers,
-    .flush         = is31fl3746a_flush,
+    .flush         = is31_common_flush,
     .set_color     = is31fl3746a_set_color,
     .set_color_all = is31fl3746a_set_color_all,
 };
@@ -127,7 +127,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #elif defined(RGB_MATRIX_SNLED27351)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = snled27351_init_drivers,
-    .flush         = snled27351_flush,
+    .flush         = is31_common_flush,
     .set_color     = snled27351_set_color,
     .set_color_all = snled27351_set_color_all,
 };
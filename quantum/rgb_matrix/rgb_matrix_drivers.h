@@ -9,30 +9,43 @@
 #    include "aw20216s.h"
 #elif defined(RGB_MATRIX_IS31FL3236)
 #    include "is31fl3236.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3218)
 #    include "is31fl3218.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3729)
 #    include "is31fl3729.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3731)
 #    include "is31fl3731.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3733)
 #    include "is31fl3733.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3736)
 #    include "is31fl3736.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3737)
 #    include "is31fl3737.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3741)
 #    include "is31fl3741.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3742A)
 #    include "is31fl3742a.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3743A)
 #    include "is31fl3743a.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3745)
 #    include "is31fl3745.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_IS31FL3746A)
 #    include "is31fl3746a.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_SNLED27351)
 #    include "snled27351.h"
+#    include "is31_common.h"
 #elif defined(RGB_MATRIX_WS2812)
 #    include "ws2812.h"
 #endif
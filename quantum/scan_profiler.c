@@ -0,0 +1,309 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "scan_profiler.h"
+#include "bitwise.h"
+#include "util.h"
+#include "progmem.h"
+#include "timer.h"
+#include "raw_hid.h"
+
+#if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
+#    include <util/atomic.h>
+#    include "timer_avr.h"
+#elif defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
+
+// How often the tick frequency is re-measured against the millisecond timer
+#ifndef SCAN_PROFILER_CALIBRATION_MS
+#    define SCAN_PROFILER_CALIBRATION_MS 100
+#endif
+
+#if SCAN_PROFILER_HISTOGRAM_BUCKETS > 33
+#    error SCAN_PROFILER_HISTOGRAM_BUCKETS must be 33 or less
+#endif
+
+enum scan_profiler_raw_hid_command {
+    scan_profiler_cmd_get_info      = 0x01,
+    scan_profiler_cmd_get_stats     = 0x02,
+    scan_profiler_cmd_get_histogram = 0x03,
+    scan_profiler_cmd_get_name      = 0x04,
+    scan_profiler_cmd_reset         = 0x05,
+};
+
+#define SCAN_PROFILER_PROTOCOL_VERSION 1
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint16_t histogram[SCAN_PROFILER_HISTOGRAM_BUCKETS];
+} scan_profiler_stage_data_t;
+
+static scan_profiler_stage_data_t stage_data[SCAN_PROFILER_STAGE_COUNT];
+
+static uint32_t loop_start_ts    = 0;
+static uint32_t last_mark_ts     = 0;
+static uint32_t last_end_ts      = 0;
+static bool     has_previous_run = false;
+
+static uint32_t calibration_ts    = 0;
+static uint32_t calibration_ms    = 0;
+static uint32_t ticks_per_ms      = 0;
+static bool     calibration_valid = false;
+
+// clang-format off
+static const char stage_names[SCAN_PROFILER_STAGE_COUNT][16] PROGMEM = {
+    [SCAN_PROFILER_STAGE_MATRIX]          = "matrix",
+    [SCAN_PROFILER_STAGE_QUANTUM]         = "quantum",
+    [SCAN_PROFILER_STAGE_SPLIT_WATCHDOG]  = "split_watchdog",
+    [SCAN_PROFILER_STAGE_RGBLIGHT]        = "rgblight",
+    [SCAN_PROFILER_STAGE_LED_MATRIX]      = "led_matrix",
+    [SCAN_PROFILER_STAGE_RGB_MATRIX]      = "rgb_matrix",
+    [SCAN_PROFILER_STAGE_BACKLIGHT]       = "backlight",
+    [SCAN_PROFILER_STAGE_ENCODER]         = "encoder",
+    [SCAN_PROFILER_STAGE_POINTING_DEVICE] = "pointing_device",
+    [SCAN_PROFILER_STAGE_OLED]            = "oled",
+    [SCAN_PROFILER_STAGE_ST7565]          = "st7565",
+    [SCAN_PROFILER_STAGE_MOUSEKEY]        = "mousekey",
+    [SCAN_PROFILER_STAGE_PS2_MOUSE]       = "ps2_mouse",
+    [SCAN_PROFILER_STAGE_MIDI]            = "midi",
+    [SCAN_PROFILER_STAGE_JOYSTICK]        = "joystick",
+    [SCAN_PROFILER_STAGE_BLUETOOTH]       = "bluetooth",
+    [SCAN_PROFILER_STAGE_HAPTIC]          = "haptic",
+    [SCAN_PROFILER_STAGE_LED]             = "led",
+    [SCAN_PROFILER_STAGE_OS_DETECTION]    = "os_detection",
+    [SCAN_PROFILER_STAGE_OUTSIDE]         = "outside",
+    [SCAN_PROFILER_STAGE_LOOP]            = "loop",
+};
+// clang-format on
+
+uint32_t scan_profiler_timestamp(void) {
+#if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
+    // Timer0 runs in CTC mode and wraps every millisecond, so combine it with the millisecond count
+    uint32_t ts;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        ts = timer_read32() * (TIMER_RAW_TOP + 1) + TIMER_RAW;
+    }
+    return ts;
+#elif defined(PROTOCOL_CHIBIOS) && defined(PORT_SUPPORTS_RT) && (PORT_SUPPORTS_RT == TRUE)
+    return chSysGetRealtimeCounterX();
+#else
+    return timer_read32();
+#endif
+}
+
+uint32_t scan_profiler_ticks_per_ms(void) {
+    return ticks_per_ms;
+}
+
+static void scan_profiler_calibrate(uint32_t now_ts) {
+    uint32_t now_ms = timer_read32();
+    if (!calibration_valid) {
+        calibration_ts    = now_ts;
+        calibration_ms    = now_ms;
+        calibration_valid = true;
+        return;
+    }
+
+    uint32_t elapsed_ms = TIMER_DIFF_32(now_ms, calibration_ms);
+    if (elapsed_ms >= SCAN_PROFILER_CALIBRATION_MS) {
+        ticks_per_ms   = (now_ts - calibration_ts) / elapsed_ms;
+        calibration_ts = now_ts;
+        calibration_ms = now_ms;
+    }
+}
+
+static uint8_t scan_profiler_bucket(uint32_t ticks) {
+    uint8_t bucket = ticks ? biton32(ticks) + 1 : 0;
+    return bucket < SCAN_PROFILER_HISTOGRAM_BUCKETS ? bucket : SCAN_PROFILER_HISTOGRAM_BUCKETS - 1;
+}
+
+void scan_profiler_record(scan_profiler_stage_t stage, uint32_t ticks) {
+    if (stage >= SCAN_PROFILER_STAGE_COUNT) {
+        return;
+    }
+
+    scan_profiler_stage_data_t *data = &stage_data[stage];
+    if (data->count == 0 || ticks < data->min) {
+        data->min = ticks;
+    }
+    if (ticks > data->max) {
+        data->max = ticks;
+    }
+    data->count++;
+    data->sum += ticks;
+
+    uint16_t *bucket = &data->histogram[scan_profiler_bucket(ticks)];
+    if (*bucket == UINT16_MAX) {
+        // Halve everything rather than saturating, so the distribution keeps its shape
+        for (uint8_t i = 0; i < SCAN_PROFILER_HISTOGRAM_BUCKETS; i++) {
+            data->histogram[i] >>= 1;
+        }
+    }
+    (*bucket)++;
+}
+
+void scan_profiler_begin(void) {
+    uint32_t now = scan_profiler_timestamp();
+    if (has_previous_run) {
+        scan_profiler_record(SCAN_PROFILER_STAGE_OUTSIDE, now - last_end_ts);
+        scan_profiler_record(SCAN_PROFILER_STAGE_LOOP, now - loop_start_ts);
+    }
+    scan_profiler_calibrate(now);
+    loop_start_ts = now;
+    last_mark_ts  = now;
+}
+
+void scan_profiler_mark(scan_profiler_stage_t stage) {
+    uint32_t now = scan_profiler_timestamp();
+    scan_profiler_record(stage, now - last_mark_ts);
+    last_mark_ts = now;
+}
+
+void scan_profiler_end(void) {
+    last_end_ts      = scan_profiler_timestamp();
+    has_previous_run = true;
+}
+
+void scan_profiler_reset(void) {
+    memset(stage_data, 0, sizeof(stage_data));
+    has_previous_run = false;
+}
+
+static uint32_t scan_profiler_percentile(const scan_profiler_stage_data_t *data, uint8_t percent) {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < SCAN_PROFILER_HISTOGRAM_BUCKETS; i++) {
+        total += data->histogram[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    uint32_t target     = (total * percent + 99) / 100;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < SCAN_PROFILER_HISTOGRAM_BUCKETS; i++) {
+        cumulative += data->histogram[i];
+        if (cumulative >= target) {
+            // Report the upper bound of the bucket, clamped to what was actually observed
+            uint32_t upper = i == 0 ? 0 : (i >= 32 ? UINT32_MAX : (((uint32_t)1 << i) - 1));
+            return upper < data->max ? upper : data->max;
+        }
+    }
+    return data->max;
+}
+
+bool scan_profiler_get_stats(scan_profiler_stage_t stage, scan_profiler_stats_t *stats) {
+    if (stage >= SCAN_PROFILER_STAGE_COUNT) {
+        return false;
+    }
+
+    const scan_profiler_stage_data_t *data = &stage_data[stage];
+
+    stats->count = data->count;
+    stats->min   = data->min;
+    stats->max   = data->max;
+    stats->p50   = scan_profiler_percentile(data, 50);
+    stats->p99   = scan_profiler_percentile(data, 99);
+    stats->mean  = data->count ? (uint32_t)(data->sum / data->count) : 0;
+    return true;
+}
+
+const uint16_t *scan_profiler_get_histogram(scan_profiler_stage_t stage) {
+    if (stage >= SCAN_PROFILER_STAGE_COUNT) {
+        return NULL;
+    }
+    return stage_data[stage].histogram;
+}
+
+const char *scan_profiler_stage_name_P(scan_profiler_stage_t stage) {
+    if (stage >= SCAN_PROFILER_STAGE_COUNT) {
+        return NULL;
+    }
+    return stage_names[stage];
+}
+
+static uint8_t *scan_profiler_write_u32(uint8_t *p, uint32_t value) {
+    // Big endian, matching the VIA protocol
+    *p++ = (value >> 24) & 0xFF;
+    *p++ = (value >> 16) & 0xFF;
+    *p++ = (value >> 8) & 0xFF;
+    *p++ = value & 0xFF;
+    return p;
+}
+
+bool scan_profiler_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != SCAN_PROFILER_RAW_HID_ID) {
+        return false;
+    }
+
+    uint8_t  command = data[1];
+    uint8_t  stage   = data[2];
+    uint8_t *reply   = &data[3];
+    uint8_t *end     = &data[length];
+
+    switch (command) {
+        case scan_profiler_cmd_get_info: {
+            reply[0] = SCAN_PROFILER_PROTOCOL_VERSION;
+            reply[1] = SCAN_PROFILER_STAGE_COUNT;
+            reply[2] = SCAN_PROFILER_HISTOGRAM_BUCKETS;
+            scan_profiler_write_u32(&reply[3], ticks_per_ms);
+            break;
+        }
+        case scan_profiler_cmd_get_stats: {
+            scan_profiler_stats_t stats;
+            if (length < 27 || !scan_profiler_get_stats(stage, &stats)) {
+                data[1] = 0xFF;
+                break;
+            }
+            uint8_t *p = reply;
+            p          = scan_profiler_write_u32(p, stats.count);
+            p          = scan_profiler_write_u32(p, stats.min);
+            p          = scan_profiler_write_u32(p, stats.max);
+            p          = scan_profiler_write_u32(p, stats.p50);
+            p          = scan_profiler_write_u32(p, stats.p99);
+            scan_profiler_write_u32(p, stats.mean);
+            break;
+        }
+        case scan_profiler_cmd_get_histogram: {
+            // data[3] is the first bucket to send, as many buckets as fit are returned after it
+            const uint16_t *histogram = scan_profiler_get_histogram(stage);
+            if (histogram == NULL) {
+                data[1] = 0xFF;
+                break;
+            }
+            uint8_t  bucket = reply[0];
+            uint8_t *p      = &reply[1];
+            while (bucket < SCAN_PROFILER_HISTOGRAM_BUCKETS && p + 2 <= end) {
+                *p++ = histogram[bucket] >> 8;
+                *p++ = histogram[bucket] & 0xFF;
+                bucket++;
+            }
+            break;
+        }
+        case scan_profiler_cmd_get_name: {
+            const char *name = scan_profiler_stage_name_P(stage);
+            if (name == NULL) {
+                data[1] = 0xFF;
+                break;
+            }
+            memset(reply, 0, end - reply);
+            memcpy_P(reply, name, MIN(sizeof(stage_names[0]), (size_t)(end - reply)));
+            break;
+        }
+        case scan_profiler_cmd_reset: {
+            scan_profiler_reset();
+            break;
+        }
+        default: {
+            data[1] = 0xFF;
+            break;
+        }
+    }
+
+    raw_hid_send(data, length);
+    return true;
+}
@@ -0,0 +1,125 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \defgroup scan_profiler Scan Profiler API
+ *
+ * \brief Measures how long each stage of keyboard_task() takes, using the
+ * highest resolution counter available on the platform.
+ *
+ * Every stage keeps a log2 histogram of its durations as well as min/max,
+ * which can be queried over raw HID (see `qmk profiler`) or from user code.
+ *
+ * \{
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef SCAN_PROFILER_HISTOGRAM_BUCKETS
+#    define SCAN_PROFILER_HISTOGRAM_BUCKETS 24
+#endif
+
+#ifndef SCAN_PROFILER_RAW_HID_ID
+#    define SCAN_PROFILER_RAW_HID_ID 0xFD
+#endif
+
+/** \brief Stages measured by the profiler, in keyboard_task() order
+ */
+typedef enum {
+    SCAN_PROFILER_STAGE_MATRIX,
+    SCAN_PROFILER_STAGE_QUANTUM,
+    SCAN_PROFILER_STAGE_SPLIT_WATCHDOG,
+    SCAN_PROFILER_STAGE_RGBLIGHT,
+    SCAN_PROFILER_STAGE_LED_MATRIX,
+    SCAN_PROFILER_STAGE_RGB_MATRIX,
+    SCAN_PROFILER_STAGE_BACKLIGHT,
+    SCAN_PROFILER_STAGE_ENCODER,
+    SCAN_PROFILER_STAGE_POINTING_DEVICE,
+    SCAN_PROFILER_STAGE_OLED,
+    SCAN_PROFILER_STAGE_ST7565,
+    SCAN_PROFILER_STAGE_MOUSEKEY,
+    SCAN_PROFILER_STAGE_PS2_MOUSE,
+    SCAN_PROFILER_STAGE_MIDI,
+    SCAN_PROFILER_STAGE_JOYSTICK,
+    SCAN_PROFILER_STAGE_BLUETOOTH,
+    SCAN_PROFILER_STAGE_HAPTIC,
+    SCAN_PROFILER_STAGE_LED,
+    SCAN_PROFILER_STAGE_OS_DETECTION,
+    SCAN_PROFILER_STAGE_OUTSIDE, // everything between two keyboard_task() calls (USB, raw HID, painter, housekeeping...)
+    SCAN_PROFILER_STAGE_LOOP,    // full main loop period
+    SCAN_PROFILER_STAGE_COUNT,
+} scan_profiler_stage_t;
+
+/** \brief Summary of the samples recorded for a stage, all durations in ticks
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t mean;
+} scan_profiler_stats_t;
+
+/** \brief Reads the profiler's free running tick counter
+ */
+uint32_t scan_profiler_timestamp(void);
+
+/** \brief Number of profiler ticks per millisecond, calibrated at runtime against timer_read32()
+ */
+uint32_t scan_profiler_ticks_per_ms(void);
+
+/** \brief Marks the start of keyboard_task()
+ */
+void scan_profiler_begin(void);
+
+/** \brief Attributes the time since the previous mark to the given stage
+ */
+void scan_profiler_mark(scan_profiler_stage_t stage);
+
+/** \brief Marks the end of keyboard_task()
+ */
+void scan_profiler_end(void);
+
+/** \brief Adds a sample to the given stage's statistics
+ */
+void scan_profiler_record(scan_profiler_stage_t stage, uint32_t ticks);
+
+/** \brief Clears all recorded samples
+ */
+void scan_profiler_reset(void);
+
+/** \brief Retrieves the summary of a stage
+ *
+ * \return false if the stage is out of range
+ */
+bool scan_profiler_get_stats(scan_profiler_stage_t stage, scan_profiler_stats_t *stats);
+
+/** \brief Retrieves the raw histogram of a stage, bucket N counts durations in [2^(N-1), 2^N) ticks
+ *
+ * Once a bucket reaches UINT16_MAX all buckets of the stage are halved, so the counts keep their proportions.
+ *
+ * \return a pointer to SCAN_PROFILER_HISTOGRAM_BUCKETS counters, or NULL if the stage is out of range
+ */
+const uint16_t *scan_profiler_get_histogram(scan_profiler_stage_t stage);
+
+/** \brief Human readable name of a stage
+ *
+ * \return a PROGMEM pointer to a NUL padded name of up to 16 characters, read it with the _P functions, or NULL if the stage is out of range
+ */
+const char *scan_profiler_stage_name_P(scan_profiler_stage_t stage);
+
+/** \brief Handles profiler queries arriving over raw HID
+ *
+ * Called automatically when VIA is enabled, otherwise call it from raw_hid_receive().
+ *
+ * \return true if the packet was a profiler query and a reply has been sent
+ */
+bool scan_profiler_raw_hid_receive(uint8_t *data, uint8_t length);
+
+/** \} */
@@ -3,6 +3,7 @@
 
 #include "secure.h"
 #include "timer.h"
+#include "deadline_scheduler.h"
 #include "util.h"
 
 #ifndef SECURE_UNLOCK_TIMEOUT
@@ -41,6 +42,7 @@ void secure_lock(void) {
 void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
     idle_time     = timer_read32();
+    deadline_wake(DEADLINE_SECURE);
     secure_hook(secure_status);
 }
 
@@ -48,6 +50,7 @@ void secure_request_unlock(void) {
     if (secure_status == SECURE_LOCKED) {
         secure_status = SECURE_PENDING;
         unlock_time   = timer_read32();
+        deadline_wake(DEADLINE_SECURE);
     }
     secure_hook(secure_status);
 }
@@ -79,8 +82,12 @@ void secure_task(void) {
 #if SECURE_UNLOCK_TIMEOUT != 0
     // handle unlock timeout
     if (secure_status == SECURE_PENDING) {
-        if (timer_elapsed32(unlock_time) >= SECURE_UNLOCK_TIMEOUT) {
+        uint32_t elapsed = timer_elapsed32(unlock_time);
+        if (elapsed >= SECURE_UNLOCK_TIMEOUT) {
             secure_lock();
+        } else {
+            deadline_set(DEADLINE_SECURE, SECURE_UNLOCK_TIMEOUT - elapsed);
+            return;
         }
     }
 #endif
@@ -88,11 +95,17 @@ void secure_task(void) {
 #if SECURE_IDLE_TIMEOUT != 0
     // handle idle timeout
     if (secure_status == SECURE_UNLOCKED) {
-        if (timer_elapsed32(idle_time) >= SECURE_IDLE_TIMEOUT) {
+        uint32_t elapsed = timer_elapsed32(idle_time);
+        if (elapsed >= SECURE_IDLE_TIMEOUT) {
             secure_lock();
+        } else {
+            deadline_set(DEADLINE_SECURE, SECURE_IDLE_TIMEOUT - elapsed);
+            return;
         }
     }
 #endif
+
+    deadline_clear(DEADLINE_SECURE);
 }
 
 __attribute__((weak)) bool secure_hook_user(secure_status_t secure_status) {
@@ -97,6 +97,10 @@ enum serial_transaction_id {
     PUT_ACTIVITY,
 #endif // SPLIT_ACTIVITY_ENABLE
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    PUT_BATCH,
+#endif // SPLIT_TRANSPORT_BATCH
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
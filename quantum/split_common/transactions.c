@@ -84,7 +84,13 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#ifdef SPLIT_TRANSPORT_BATCH
+// State-only writes are staged in shared memory and sent together, see batch_handlers_master()
+static bool batch_write(int8_t id, const void *data, size_t length);
+#    define transport_write(id, data, length) batch_write(id, data, length)
+#else // SPLIT_TRANSPORT_BATCH
+#    define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#endif // SPLIT_TRANSPORT_BATCH
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
@@ -183,10 +189,27 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
     matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
+#ifdef SERIAL_USART_SLAVE_PUSH
+    static bool push_lost = false; // a push was dropped, so read the matrix until a read succeeds
+
+    // The slave pushes its matrix whenever it changes, so only poll it when a forced sync is due or a push was lost
+    if (transport_pushed(GET_SLAVE_MATRIX_DATA)) {
+        memcpy(last_matrix, split_shmem->smatrix.matrix, sizeof(last_matrix));
+    }
+    push_lost |= transport_push_failed();
+    if (!push_lost && timer_elapsed32(last_update) < FORCED_SYNC_THROTTLE_MS) {
+        memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+        return true;
+    }
+#endif // SERIAL_USART_SLAVE_PUSH
+
     bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+#ifdef SERIAL_USART_SLAVE_PUSH
+        push_lost = false;
+#endif // SERIAL_USART_SLAVE_PUSH
     }
     // Copy out the last-known-good matrix state to the slave matrix
     memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
@@ -194,13 +217,25 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_shared_memory_lock();
+#ifdef SERIAL_USART_SLAVE_PUSH
+    bool changed = memcmp(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix)) != 0;
+#endif // SERIAL_USART_SLAVE_PUSH
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    split_shared_memory_unlock();
+
+#ifdef SERIAL_USART_SLAVE_PUSH
+    // Pushing takes the lock itself
+    if (changed) {
+        transport_push(GET_SLAVE_MATRIX_DATA);
+    }
+#endif // SERIAL_USART_SLAVE_PUSH
 }
 
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
@@ -914,6 +949,264 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Batched transport
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+// Each record is {region, offset, count} followed by count bytes
+#    define BATCH_RECORD_HEADER 3
+
+_Static_assert(SPLIT_TRANSPORT_BATCH_SIZE > BATCH_RECORD_HEADER && SPLIT_TRANSPORT_BATCH_SIZE < 255, "SPLIT_TRANSPORT_BATCH_SIZE must be between 4 and 254");
+
+// Transactions that only mirror master state into shared memory, and so can be delta encoded.
+// Anything with a slave callback, one-shot semantics or timing requirements stays a direct transaction.
+// clang-format off
+#    ifdef SPLIT_TRANSPORT_MIRROR
+#        define BATCH_REGIONS_MASTER_MATRIX(X) X(PUT_MASTER_MATRIX, mmatrix.matrix)
+#    else
+#        define BATCH_REGIONS_MASTER_MATRIX(X)
+#    endif
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#        define BATCH_REGIONS_LAYER_STATE(X) X(PUT_LAYER_STATE, layers.layer_state) X(PUT_DEFAULT_LAYER_STATE, layers.default_layer_state)
+#    else
+#        define BATCH_REGIONS_LAYER_STATE(X)
+#    endif
+#    ifdef SPLIT_LED_STATE_ENABLE
+#        define BATCH_REGIONS_LED_STATE(X) X(PUT_LED_STATE, led_state)
+#    else
+#        define BATCH_REGIONS_LED_STATE(X)
+#    endif
+#    ifdef SPLIT_MODS_ENABLE
+#        define BATCH_REGIONS_MODS(X) X(PUT_MODS, mods)
+#    else
+#        define BATCH_REGIONS_MODS(X)
+#    endif
+#    ifdef BACKLIGHT_ENABLE
+#        define BATCH_REGIONS_BACKLIGHT(X) X(PUT_BACKLIGHT, backlight_level)
+#    else
+#        define BATCH_REGIONS_BACKLIGHT(X)
+#    endif
+#    if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+#        define BATCH_REGIONS_LED_MATRIX(X) X(PUT_LED_MATRIX, led_matrix_sync)
+#    else
+#        define BATCH_REGIONS_LED_MATRIX(X)
+#    endif
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#        define BATCH_REGIONS_RGB_MATRIX(X) X(PUT_RGB_MATRIX, rgb_matrix_sync)
+#    else
+#        define BATCH_REGIONS_RGB_MATRIX(X)
+#    endif
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#        define BATCH_REGIONS_WPM(X) X(PUT_WPM, current_wpm)
+#    else
+#        define BATCH_REGIONS_WPM(X)
+#    endif
+#    if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+#        define BATCH_REGIONS_OLED(X) X(PUT_OLED, current_oled_state)
+#    else
+#        define BATCH_REGIONS_OLED(X)
+#    endif
+#    if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+#        define BATCH_REGIONS_ST7565(X) X(PUT_ST7565, current_st7565_state)
+#    else
+#        define BATCH_REGIONS_ST7565(X)
+#    endif
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#        define BATCH_REGIONS_POINTING(X) X(PUT_POINTING_CPI, pointing.cpi)
+#    else
+#        define BATCH_REGIONS_POINTING(X)
+#    endif
+#    if defined(SPLIT_ACTIVITY_ENABLE)
+#        define BATCH_REGIONS_ACTIVITY(X) X(PUT_ACTIVITY, activity_sync)
+#    else
+#        define BATCH_REGIONS_ACTIVITY(X)
+#    endif
+#    if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+#        define BATCH_REGIONS_DETECTED_OS(X) X(PUT_DETECTED_OS, detected_os)
+#    else
+#        define BATCH_REGIONS_DETECTED_OS(X)
+#    endif
+
+#    define BATCH_REGIONS(X) \
+    BATCH_REGIONS_MASTER_MATRIX(X) \
+    BATCH_REGIONS_LAYER_STATE(X) \
+    BATCH_REGIONS_LED_STATE(X) \
+    BATCH_REGIONS_MODS(X) \
+    BATCH_REGIONS_BACKLIGHT(X) \
+    BATCH_REGIONS_LED_MATRIX(X) \
+    BATCH_REGIONS_RGB_MATRIX(X) \
+    BATCH_REGIONS_WPM(X) \
+    BATCH_REGIONS_OLED(X) \
+    BATCH_REGIONS_ST7565(X) \
+    BATCH_REGIONS_POINTING(X) \
+    BATCH_REGIONS_ACTIVITY(X) \
+    BATCH_REGIONS_DETECTED_OS(X)
+
+#    define BATCH_REGION_ID(id, member) id,
+#    define BATCH_REGION_SIZE(id, member) + sizeof_member(split_shared_memory_t, member)
+// clang-format on
+
+static const int8_t batch_regions[] = {BATCH_REGIONS(BATCH_REGION_ID)};
+
+// Last state the slave acknowledged, the batched regions packed back to back in table order
+static uint8_t batch_acked[0 BATCH_REGIONS(BATCH_REGION_SIZE)];
+static bool    batch_resync = true;
+
+static int8_t batch_region_index(int8_t id) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(batch_regions); i++) {
+        if (batch_regions[i] == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint8_t batch_checksum(void) {
+    uint8_t region_crc[ARRAY_SIZE(batch_regions)];
+    for (uint8_t i = 0; i < ARRAY_SIZE(batch_regions); i++) {
+        split_transaction_desc_t *trans = &split_transaction_table[batch_regions[i]];
+        region_crc[i]                   = crc8(split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    }
+    return crc8(region_crc, sizeof(region_crc));
+}
+
+static bool batch_write(int8_t id, const void *data, size_t length) {
+    if (batch_region_index(id) < 0) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    memmove(split_trans_initiator2target_buffer(trans), data, MIN(length, trans->initiator2target_buffer_size));
+    return true;
+}
+
+static bool batch_send_frame(split_batch_frame_t *frame, uint8_t *checksum) {
+    bool okay     = transport_execute_transaction(PUT_BATCH, frame, sizeof(frame->length) + frame->length, checksum, sizeof(*checksum));
+    frame->length = 0;
+    return okay;
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t     last_update = 0;
+    split_batch_frame_t frame       = {.length = 0};
+    uint8_t             checksum    = 0;
+    bool                sent        = false;
+
+    const uint8_t *acked = batch_acked;
+    for (uint8_t region = 0; region < ARRAY_SIZE(batch_regions); region++) {
+        split_transaction_desc_t *trans  = &split_transaction_table[batch_regions[region]];
+        const uint8_t            *staged = split_trans_initiator2target_buffer(trans);
+        uint8_t                   size   = trans->initiator2target_buffer_size;
+
+        uint8_t pos = 0;
+        while (pos < size) {
+            if (!batch_resync && staged[pos] == acked[pos]) {
+                pos++;
+                continue;
+            }
+
+            // Extend the run over short unchanged gaps, they are cheaper than starting a new record
+            uint8_t last = pos;
+            for (uint8_t i = pos + 1; i < size && i - last <= BATCH_RECORD_HEADER; i++) {
+                if (batch_resync || staged[i] != acked[i]) {
+                    last = i;
+                }
+            }
+
+            if (SPLIT_TRANSPORT_BATCH_SIZE - frame.length <= BATCH_RECORD_HEADER) {
+                if (!batch_send_frame(&frame, &checksum)) {
+                    batch_resync = true;
+                    return false;
+                }
+                sent = true;
+            }
+
+            uint8_t count = MIN(last - pos + 1, SPLIT_TRANSPORT_BATCH_SIZE - frame.length - BATCH_RECORD_HEADER);
+            frame.data[frame.length++] = region;
+            frame.data[frame.length++] = pos;
+            frame.data[frame.length++] = count;
+            memcpy(&frame.data[frame.length], &staged[pos], count);
+            frame.length += count;
+            pos += count;
+        }
+        acked += size;
+    }
+
+    // Nothing changed, but periodically confirm the slave still holds the same state, eg. after it reset
+    if (frame.length == 0 && !sent && !batch_resync && timer_elapsed32(last_update) < FORCED_SYNC_THROTTLE_MS) {
+        return true;
+    }
+
+    if (frame.length > 0 || !sent) {
+        if (!batch_send_frame(&frame, &checksum)) {
+            batch_resync = true;
+            return false;
+        }
+    }
+
+    // The slave answers with the checksum of its copy after applying the frame, any mismatch triggers a full resend
+    if (checksum != batch_checksum()) {
+        batch_resync = true;
+        return false;
+    }
+
+    uint8_t *copy = batch_acked;
+    for (uint8_t region = 0; region < ARRAY_SIZE(batch_regions); region++) {
+        split_transaction_desc_t *trans = &split_transaction_table[batch_regions[region]];
+        memcpy(copy, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        copy += trans->initiator2target_buffer_size;
+    }
+    batch_resync = false;
+    last_update  = timer_read32();
+    return true;
+}
+
+// Records are applied as soon as the frame arrives, so there is no per-scan slave handler
+static void batch_handlers_slave_apply(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_batch_frame_t *frame = (const split_batch_frame_t *)initiator2target_buffer;
+    const uint8_t             *data  = frame->data;
+    const uint8_t             *end   = data + MIN(frame->length, SPLIT_TRANSPORT_BATCH_SIZE);
+
+    while (end - data > BATCH_RECORD_HEADER) {
+        uint8_t region = data[0];
+        uint8_t offset = data[1];
+        uint8_t count  = data[2];
+        data += BATCH_RECORD_HEADER;
+
+        // Corrupted frames are dropped here, and caught by the master through the checksum
+        if (region >= ARRAY_SIZE(batch_regions) || count > end - data) {
+            break;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[batch_regions[region]];
+        if (offset + count > trans->initiator2target_buffer_size) {
+            break;
+        }
+
+        memcpy(split_trans_initiator2target_buffer(trans) + offset, data, count);
+        data += count;
+    }
+
+    *(uint8_t *)target2initiator_buffer = batch_checksum();
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [PUT_BATCH] = { \
+        sizeof_member(split_shared_memory_t, batch.frame), offsetof(split_shared_memory_t, batch.frame), \
+        sizeof_member(split_shared_memory_t, batch.checksum), offsetof(split_shared_memory_t, batch.checksum), \
+        batch_handlers_slave_apply \
+    },
+// clang-format on
+
+#else // SPLIT_TRANSPORT_BATCH
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BATCH
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -944,6 +1237,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -974,6 +1268,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
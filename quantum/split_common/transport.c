@@ -24,6 +24,10 @@
 
 #ifdef USE_I2C
 
+#    ifdef SERIAL_USART_SLAVE_PUSH
+#        error SERIAL_USART_SLAVE_PUSH is not supported by the I2C transport
+#    endif
+
 #    ifndef SLAVE_I2C_TIMEOUT
 #        define SLAVE_I2C_TIMEOUT 100
 #    endif // SLAVE_I2C_TIMEOUT
@@ -119,6 +123,24 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SERIAL_USART_SLAVE_PUSH
+#        ifdef SERIAL_DRIVER_BITBANG
+#            error SERIAL_USART_SLAVE_PUSH requires the usart or vendor serial driver
+#        endif
+
+bool transport_push(int8_t id) {
+    return soft_serial_target_push(id);
+}
+
+bool transport_pushed(int8_t id) {
+    return soft_serial_initiator_pushed(id);
+}
+
+bool transport_push_failed(void) {
+    return soft_serial_initiator_push_failed();
+}
+#    endif // SERIAL_USART_SLAVE_PUSH
+
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
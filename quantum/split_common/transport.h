@@ -31,6 +31,10 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_TRANSPORT_BATCH_SIZE
+#    define SPLIT_TRANSPORT_BATCH_SIZE 32
+#endif // SPLIT_TRANSPORT_BATCH_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -40,6 +44,15 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SERIAL_USART_SLAVE_PUSH
+// slave sends the target2initiator buffer of a transaction without being asked
+bool transport_push(int8_t id);
+// master checks whether the slave pushed that buffer since the last call
+bool transport_pushed(int8_t id);
+// master checks whether a push was dropped since the last call
+bool transport_push_failed(void);
+#endif // SERIAL_USART_SLAVE_PUSH
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -147,6 +160,18 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+typedef struct _split_batch_frame_t {
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSPORT_BATCH_SIZE];
+} split_batch_frame_t;
+
+typedef struct _split_batch_sync_t {
+    split_batch_frame_t frame;
+    uint8_t             checksum;
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
@@ -222,6 +247,10 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
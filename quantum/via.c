@@ -57,6 +57,10 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(SCAN_PROFILER_ENABLE)
+#    include "scan_profiler.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -280,6 +284,12 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
 
+#ifdef SCAN_PROFILER_ENABLE
+    if (scan_profiler_raw_hid_receive(data, length)) {
+        return;
+    }
+#endif
+
     // If via_command_kb() returns true, the command was fully
     // handled, including calling raw_hid_send()
     if (via_command_kb(data, length)) {
@@ -0,0 +1,197 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingWriteBehind : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        verify_data.fill(0);
+    }
+
+    static std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    static wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    static void verify_after_init(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        for (int i = 0; i < WEAR_LEVELING_LOGICAL_SIZE; ++i) {
+            EXPECT_EQ(readback[i], verify_data[i]) << "Invalid readback at " << i;
+        }
+    }
+};
+
+std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> WearLevelingWriteBehind::verify_data;
+
+/**
+ * This test verifies that a write only updates the cache, and that nothing reaches the backing store until drained.
+ */
+TEST_F(WearLevelingWriteBehind, WriteIsDeferred) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_val = 0x14;
+    EXPECT_EQ(test_write(0x02, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.unlock_invoke_count(), 0) << "Unlock should not have been invoked";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked";
+    EXPECT_TRUE(wear_leveling_pending()) << "Write should be queued";
+
+    uint8_t readback = 0;
+    EXPECT_EQ(wear_leveling_read(0x02, &readback, sizeof(readback)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, test_val) << "Cache should hold the new value";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_FALSE(wear_leveling_pending()) << "Queue should be empty after flushing";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1) << "Unlock should have been invoked once";
+    EXPECT_EQ(inst.write_invoke_count(), 1) << "Write should have been invoked once";
+    EXPECT_EQ(inst.lock_invoke_count(), 1) << "Lock should have been invoked once";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that repeated writes to the same address only reach the backing store once.
+ */
+TEST_F(WearLevelingWriteBehind, RepeatedWritesCoalesced) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (uint8_t i = 1; i <= 10; ++i) {
+        uint8_t test_val[3] = {i, (uint8_t)(i + 1), (uint8_t)(i + 2)};
+        EXPECT_EQ(test_write(0x04, test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 3) << "Only the last value should have been written";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that only the bytes that changed are queued.
+ */
+TEST_F(WearLevelingWriteBehind, UnchangedBytesSkipped) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, 8> test_val{};
+    test_val[3] = 0x55;
+    EXPECT_EQ(test_write(0x00, test_val.data(), test_val.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 1) << "Only the changed byte should have been written";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that draining writes no more than the budget to the log per call.
+ */
+TEST_F(WearLevelingWriteBehind, DrainBudget) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, 12> test_val;
+    std::iota(test_val.begin(), test_val.end(), 0x20);
+    EXPECT_EQ(test_write(0x02, test_val.data(), test_val.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    int calls = 0;
+    while (wear_leveling_pending()) {
+        uint64_t write_count = inst.write_invoke_count();
+        EXPECT_EQ(wear_leveling_drain(4), WEAR_LEVELING_SUCCESS) << "Drain returned incorrect status";
+        // Each byte below address 64 is its own log entry
+        EXPECT_LE(inst.write_invoke_count() - write_count, 4) << "Drain wrote more than its budget";
+        ++calls;
+    }
+    EXPECT_EQ(calls, 3) << "Drain should have taken three calls";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that overlapping and adjacent writes are merged, and that a full queue merges the closest ranges.
+ */
+TEST_F(WearLevelingWriteBehind, QueueMerging) {
+    for (uint32_t address = 0; address < WEAR_LEVELING_LOGICAL_SIZE; address += 3) {
+        uint8_t test_val = (uint8_t)(address + 1);
+        EXPECT_EQ(test_write(address, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    for (uint32_t address = 1; address < WEAR_LEVELING_LOGICAL_SIZE; address += 7) {
+        uint8_t test_val[2] = {(uint8_t)(address + 0x80), (uint8_t)(address + 0x81)};
+        EXPECT_EQ(test_write(address, test_val, std::min<size_t>(sizeof(test_val), WEAR_LEVELING_LOGICAL_SIZE - address)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    EXPECT_NE(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush returned incorrect status";
+    EXPECT_FALSE(wear_leveling_pending()) << "Queue should be empty after flushing";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that filling the log while draining consolidates, which also empties the queue.
+ */
+TEST_F(WearLevelingWriteBehind, ConsolidationWhileDraining) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> test_val;
+    for (int pass = 0; pass < 4; ++pass) {
+        std::iota(test_val.begin(), test_val.end(), 0x20 + pass * 0x40);
+        EXPECT_EQ(test_write(0, test_val.data(), test_val.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        wear_leveling_status_t status;
+        do {
+            status = wear_leveling_drain(8);
+            EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Drain returned incorrect status";
+        } while (wear_leveling_pending());
+    }
+    EXPECT_GT(inst.erasure_count(), 0) << "The log should have been consolidated";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that early consolidation only happens once the log is mostly full and nothing is queued.
+ */
+TEST_F(WearLevelingWriteBehind, ConsolidateEarly) {
+    auto& inst = MockBackingStore::Instance();
+
+    EXPECT_EQ(wear_leveling_consolidate_early(), WEAR_LEVELING_SUCCESS) << "Empty log should not be consolidated";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should not have been invoked";
+
+    // Fill the log one entry at a time until it's past the threshold
+    const uint32_t log_size = WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8;
+    uint8_t        value    = 0;
+    while (inst.write_invoke_count() * BACKING_STORE_WRITE_SIZE < log_size * WEAR_LEVELING_WRITE_BEHIND_CONSOLIDATE / 100) {
+        ++value;
+        EXPECT_EQ(test_write(0x01, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        EXPECT_EQ(wear_leveling_consolidate_early(), WEAR_LEVELING_SUCCESS) << "Pending data should prevent consolidation";
+        EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should not have been invoked";
+
+    EXPECT_EQ(wear_leveling_consolidate_early(), WEAR_LEVELING_CONSOLIDATED) << "Log should have been consolidated";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should have been invoked once";
+    EXPECT_EQ(wear_leveling_consolidate_early(), WEAR_LEVELING_SUCCESS) << "Fresh log should not be consolidated";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that an erase drops anything still queued.
+ */
+TEST_F(WearLevelingWriteBehind, EraseClearsQueue) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_val = 0x14;
+    EXPECT_EQ(wear_leveling_write(0x02, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_FALSE(wear_leveling_pending()) << "Queue should be empty after erasing";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked";
+
+    verify_after_init();
+}
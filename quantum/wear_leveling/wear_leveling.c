@@ -76,6 +76,15 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        During writes, with WEAR_LEVELING_WRITE_BEHIND:
+            * The cache is updated with the new data.
+            * The changed range is queued, merging with any overlapping or
+                adjacent range already queued.
+            * wear_leveling_drain() later appends the queued ranges to the log
+                from the cache, a few bytes at a time.
+            * A consolidation writes the whole cache, so it also empties the
+                queue.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -155,6 +164,16 @@
         ╚════════════════╝
         0 <= Address <= 0x3FFE (16382) */
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+/**
+ * Range of logical data that has changed in the cache but not yet been written to the log.
+ */
+typedef struct wear_leveling_range_t {
+    uint32_t address;
+    uint32_t length;
+} wear_leveling_range_t;
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 /**
  * Storage area for the wear-leveling cache.
  */
@@ -162,6 +181,10 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    wear_leveling_range_t pending[(WEAR_LEVELING_WRITE_BEHIND_QUEUE_SIZE)];
+    uint8_t               pending_count;
+#endif // WEAR_LEVELING_WRITE_BEHIND
 } wear_leveling;
 
 /**
@@ -203,6 +226,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    wear_leveling.pending_count = 0;
+#endif // WEAR_LEVELING_WRITE_BEHIND
 }
 
 /**
@@ -611,6 +637,162 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+/**
+ * Removes a range from the write-behind queue.
+ */
+static void wear_leveling_dequeue(uint8_t index) {
+    --wear_leveling.pending_count;
+    memmove(&wear_leveling.pending[index], &wear_leveling.pending[index + 1], (wear_leveling.pending_count - index) * sizeof(wear_leveling_range_t));
+}
+
+/**
+ * Adds a changed range to the write-behind queue.
+ * Overlapping and adjacent ranges are merged, and if the queue is full the new range is merged with the closest one.
+ * Merging may include bytes that didn't change, which is harmless as the log is written from the cache.
+ */
+static void wear_leveling_queue(uint32_t address, uint32_t length) {
+    uint32_t end = address + length;
+
+    uint8_t i = 0;
+    while (i < wear_leveling.pending_count) {
+        const wear_leveling_range_t *range = &wear_leveling.pending[i];
+        if (range->address <= end && address <= range->address + range->length) {
+            if (range->address < address) {
+                address = range->address;
+            }
+            if (range->address + range->length > end) {
+                end = range->address + range->length;
+            }
+            wear_leveling_dequeue(i);
+            continue;
+        }
+        ++i;
+    }
+
+    if (wear_leveling.pending_count == (WEAR_LEVELING_WRITE_BEHIND_QUEUE_SIZE)) {
+        uint8_t  closest     = 0;
+        uint32_t closest_gap = UINT32_MAX;
+        for (i = 0; i < wear_leveling.pending_count; ++i) {
+            const wear_leveling_range_t *range = &wear_leveling.pending[i];
+            uint32_t                     gap   = range->address > end ? range->address - end : address - (range->address + range->length);
+            if (gap < closest_gap) {
+                closest     = i;
+                closest_gap = gap;
+            }
+        }
+        const wear_leveling_range_t *range = &wear_leveling.pending[closest];
+        if (range->address < address) {
+            address = range->address;
+        }
+        if (range->address + range->length > end) {
+            end = range->address + range->length;
+        }
+        wear_leveling_dequeue(closest);
+    }
+
+    wl_dprintf("Queued [0x%04X..0x%04X), %d ranges pending\n", (int)address, (int)end, (int)wear_leveling.pending_count + 1);
+    wear_leveling.pending[wear_leveling.pending_count].address = address;
+    wear_leveling.pending[wear_leveling.pending_count].length  = end - address;
+    ++wear_leveling.pending_count;
+}
+
+/**
+ * Writes queued logical data into the write log, at most `budget` bytes of it.
+ */
+wear_leveling_status_t wear_leveling_drain(size_t budget) {
+    if (wear_leveling.pending_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    while (budget > 0 && wear_leveling.pending_count > 0) {
+        wear_leveling_range_t *range = &wear_leveling.pending[0];
+        const size_t           chunk = range->length < budget ? range->length : budget;
+
+        status = wear_leveling_write_raw(range->address, &wear_leveling.cache[range->address], chunk);
+        if (status != WEAR_LEVELING_SUCCESS) {
+            // If consolidation occurred, then the whole cache has been written to the consolidated area, including anything still queued.
+            // If a failure occurred, leave the range queued and pass it on.
+            break;
+        }
+
+        range->address += (uint32_t)chunk;
+        range->length -= (uint32_t)chunk;
+        budget -= chunk;
+        if (range->length == 0) {
+            wear_leveling_dequeue(0);
+        }
+    }
+
+    if (status == WEAR_LEVELING_SUCCESS) {
+        // Consolidate the cache + write log if required
+        status = wear_leveling_consolidate_if_needed();
+    }
+    if (status == WEAR_LEVELING_CONSOLIDATED) {
+        wear_leveling.pending_count = 0;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Writes all queued logical data into the write log.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    return wear_leveling_drain(WEAR_LEVELING_LOGICAL_SIZE);
+}
+
+/**
+ * Returns whether any logical data is still waiting to be written to the write log.
+ */
+bool wear_leveling_pending(void) {
+    return wear_leveling.pending_count > 0;
+}
+
+/**
+ * Consolidates ahead of time if nothing is queued and the write log is mostly full.
+ */
+wear_leveling_status_t wear_leveling_consolidate_early(void) {
+    const uint32_t log_start = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    const uint32_t threshold = log_start + (uint32_t)(((uint64_t)((WEAR_LEVELING_BACKING_SIZE) - log_start) * (WEAR_LEVELING_WRITE_BEHIND_CONSOLIDATE)) / 100);
+    if (wear_leveling.pending_count > 0 || wear_leveling.write_address < threshold) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wl_dprintf("Consolidating early\n");
+    wear_leveling_status_t status = wear_leveling_consolidate_force();
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 /**
  * Wear-leveling initialization
  */
@@ -688,6 +870,21 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return true;
     }
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+    // Only queue the bytes that actually changed, the log is written from the cache later on
+    const uint8_t *p     = value;
+    uint32_t       first = 0;
+    uint32_t       last  = length - 1;
+    while (p[first] == wear_leveling.cache[address + first]) {
+        ++first;
+    }
+    while (p[last] == wear_leveling.cache[address + last]) {
+        --last;
+    }
+    memcpy(&wear_leveling.cache[address + first], &p[first], last - first + 1);
+    wear_leveling_queue(address + first, last - first + 1);
+    return WEAR_LEVELING_SUCCESS;
+#else
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
@@ -724,6 +921,7 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     return status;
+#endif // WEAR_LEVELING_WRITE_BEHIND
 }
 
 /**
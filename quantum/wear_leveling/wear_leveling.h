@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
 /**
@@ -36,6 +37,9 @@ wear_leveling_status_t wear_leveling_erase(void);
  * determine if an overwrite should occur -- if there is any data mismatch the entire block will be written to the log,
  * not just the changed bytes.
  *
+ * With WEAR_LEVELING_WRITE_BEHIND only the cache is updated here, and the changed bytes are written to the log later by
+ * wear_leveling_drain() or wear_leveling_flush().
+ *
  * @param address[in] the logical address to write data
  * @param value[in] pointer to the source buffer
  * @param length[in] length of the data
@@ -52,3 +56,39 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+/**
+ * Writes queued logical data into the write log.
+ *
+ * With WEAR_LEVELING_WRITE_BEHIND, wear_leveling_write() only updates the cache and queues the changed range. Queued
+ * ranges are written to the write log from the cache by this function, so repeated writes to the same address only
+ * ever reach the backing store once.
+ *
+ * @param budget[in] maximum number of bytes of logical data to write to the log
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_drain(size_t budget);
+
+/**
+ * Writes all queued logical data into the write log.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Returns whether any logical data is still waiting to be written to the write log.
+ */
+bool wear_leveling_pending(void);
+
+/**
+ * Consolidates ahead of time, if nothing is queued and the write log is at least WEAR_LEVELING_WRITE_BEHIND_CONSOLIDATE
+ * percent full.
+ *
+ * Intended to be called when the keyboard is idle, so that the erase doesn't happen in the middle of a later write.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_consolidate_early(void);
+#endif // WEAR_LEVELING_WRITE_BEHIND
@@ -27,6 +27,17 @@ typedef uint64_t backing_store_int_t;
 #    error WEAR_LEVELING_LOGICAL_SIZE was not set.
 #endif
 
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+// Number of separate dirty ranges kept before the closest two are merged
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_QUEUE_SIZE
+#        define WEAR_LEVELING_WRITE_BEHIND_QUEUE_SIZE 16
+#    endif
+// How full the write log must be, in percent, before wear_leveling_consolidate_early() consolidates
+#    ifndef WEAR_LEVELING_WRITE_BEHIND_CONSOLIDATE
+#        define WEAR_LEVELING_WRITE_BEHIND_CONSOLIDATE 75
+#    endif
+#endif // WEAR_LEVELING_WRITE_BEHIND
+
 #ifdef WEAR_LEVELING_DEBUG_OUTPUT
 #    include <debug.h>
 #    define bs_dprintf(...) dprintf("Backing store: " __VA_ARGS__)
@@ -65,6 +76,9 @@ typedef uint64_t backing_store_int_t;
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+#ifdef WEAR_LEVELING_WRITE_BEHIND
+_Static_assert(WEAR_LEVELING_WRITE_BEHIND_QUEUE_SIZE > 0 && WEAR_LEVELING_WRITE_BEHIND_QUEUE_SIZE <= 255, "Write-behind queue size must be between 1 and 255");
+#endif
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
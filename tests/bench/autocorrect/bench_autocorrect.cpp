@@ -0,0 +1,44 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class AutocorrectBench : public BenchFixture {
+   public:
+    KeymapKey key_a     = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey key_e     = KeymapKey(0, 1, 0, KC_E);
+    KeymapKey key_f     = KeymapKey(0, 2, 0, KC_F);
+    KeymapKey key_l     = KeymapKey(0, 3, 0, KC_L);
+    KeymapKey key_s     = KeymapKey(0, 4, 0, KC_S);
+    KeymapKey key_t     = KeymapKey(0, 5, 0, KC_T);
+    KeymapKey key_space = KeymapKey(0, 6, 0, KC_SPC);
+    KeymapKey key_bspc  = KeymapKey(0, 7, 0, KC_BSPC);
+
+    void SetUp() override {
+        autocorrect_enable();
+        set_keymap({key_a, key_e, key_f, key_l, key_s, key_t, key_space, key_bspc});
+    }
+
+    void type(std::vector<BenchEvent> &trace, std::initializer_list<KeymapKey> keys) {
+        for (const KeymapKey &key : keys) {
+            bench_tap(trace, key, 15, 25);
+        }
+    }
+};
+
+TEST_F(AutocorrectBench, WordsWithoutTypos) {
+    std::vector<BenchEvent> trace;
+    type(trace, {key_f, key_a, key_s, key_t, key_space, key_l, key_e, key_a, key_s, key_t, key_space});
+
+    run_trace("words_without_typos", trace);
+}
+
+TEST_F(AutocorrectBench, CorrectedTypo) {
+    std::vector<BenchEvent> trace;
+    // "fales" is corrected to "false" by the default dictionary
+    type(trace, {key_f, key_a, key_l, key_e, key_s, key_space});
+
+    run_trace("corrected_typo", trace);
+}
@@ -0,0 +1,59 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class ComboBench : public BenchFixture {
+   public:
+    KeymapKey key_q = KeymapKey(0, 0, 0, KC_Q);
+    KeymapKey key_w = KeymapKey(0, 1, 0, KC_W);
+    KeymapKey key_e = KeymapKey(0, 2, 0, KC_E);
+    KeymapKey key_r = KeymapKey(0, 3, 0, KC_R);
+    KeymapKey key_a = KeymapKey(0, 0, 1, KC_A);
+    KeymapKey key_s = KeymapKey(0, 1, 1, KC_S);
+    KeymapKey key_d = KeymapKey(0, 2, 1, KC_D);
+    KeymapKey key_f = KeymapKey(0, 3, 1, KC_F);
+    KeymapKey key_g = KeymapKey(0, 4, 1, KC_G);
+    KeymapKey key_h = KeymapKey(0, 5, 1, KC_H);
+
+    void SetUp() override {
+        set_keymap({key_q, key_w, key_e, key_r, key_a, key_s, key_d, key_f, key_g, key_h});
+    }
+};
+
+TEST_F(ComboBench, TypingWithoutCombos) {
+    std::vector<BenchEvent> trace;
+    // Keys that take part in no combo, and keys that do but are typed on their own
+    for (const KeymapKey &key : {key_g, key_h, key_q, key_r, key_a, key_f}) {
+        bench_tap(trace, key, 25, 35);
+    }
+
+    run_trace("typing_without_combos", trace);
+}
+
+TEST_F(ComboBench, Chords) {
+    std::vector<BenchEvent> trace;
+    trace.push_back(bench_press(key_q, 5));
+    trace.push_back(bench_press(key_w, 30));
+    trace.push_back(bench_release(key_q, 5));
+    trace.push_back(bench_release(key_w, 40));
+    trace.push_back(bench_press(key_s, 5));
+    trace.push_back(bench_press(key_d, 30));
+    trace.push_back(bench_release(key_d, 5));
+    trace.push_back(bench_release(key_s, 40));
+
+    run_trace("chords", trace);
+}
+
+TEST_F(ComboBench, RollingPastComboTerm) {
+    std::vector<BenchEvent> trace;
+    // Overlapping presses of combo keys that are too slow to form the combo
+    trace.push_back(bench_press(key_a, COMBO_TERM + 10));
+    trace.push_back(bench_press(key_s, 20));
+    trace.push_back(bench_release(key_a, 10));
+    trace.push_back(bench_release(key_s, 40));
+
+    run_trace("rolling_past_combo_term", trace);
+}
@@ -0,0 +1,26 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint16_t const qw_combo[] = {KC_Q, KC_W, COMBO_END};
+uint16_t const we_combo[] = {KC_W, KC_E, COMBO_END};
+uint16_t const er_combo[] = {KC_E, KC_R, COMBO_END};
+uint16_t const as_combo[] = {KC_A, KC_S, COMBO_END};
+uint16_t const sd_combo[] = {KC_S, KC_D, COMBO_END};
+uint16_t const df_combo[] = {KC_D, KC_F, COMBO_END};
+uint16_t const zx_combo[] = {KC_Z, KC_X, COMBO_END};
+uint16_t const xc_combo[] = {KC_X, KC_C, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(qw_combo, KC_ESC),
+    COMBO(we_combo, KC_TAB),
+    COMBO(er_combo, KC_ENT),
+    COMBO(as_combo, KC_BSPC),
+    COMBO(sd_combo, KC_DEL),
+    COMBO(df_combo, KC_LPRN),
+    COMBO(zx_combo, KC_RPRN),
+    COMBO(xc_combo, KC_MINS),
+};
+// clang-format on
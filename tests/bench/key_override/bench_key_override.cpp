@@ -0,0 +1,39 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class KeyOverrideBench : public BenchFixture {
+   public:
+    KeymapKey key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey key_bspc  = KeymapKey(0, 1, 0, KC_BSPC);
+    KeymapKey key_comm  = KeymapKey(0, 2, 0, KC_COMM);
+    KeymapKey key_a     = KeymapKey(0, 3, 0, KC_A);
+    KeymapKey key_b     = KeymapKey(0, 4, 0, KC_B);
+
+    void SetUp() override {
+        set_keymap({key_shift, key_bspc, key_comm, key_a, key_b});
+    }
+};
+
+TEST_F(KeyOverrideBench, TypingWithoutOverrides) {
+    std::vector<BenchEvent> trace;
+    bench_tap(trace, key_a, 25, 35);
+    bench_tap(trace, key_b, 25, 35);
+    bench_tap(trace, key_bspc, 25, 35);
+
+    run_trace("typing_without_overrides", trace);
+}
+
+TEST_F(KeyOverrideBench, ShiftedOverrides) {
+    std::vector<BenchEvent> trace;
+    trace.push_back(bench_press(key_shift, 30));
+    bench_tap(trace, key_bspc, 25, 35);
+    bench_tap(trace, key_a, 25, 35);
+    bench_tap(trace, key_comm, 25, 35);
+    trace.push_back(bench_release(key_shift, 40));
+
+    run_trace("shifted_overrides", trace);
+}
@@ -0,0 +1,42 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class TapDanceBench : public BenchFixture {
+   public:
+    KeymapKey dance_ab = KeymapKey(0, 0, 0, TD(0));
+    KeymapKey dance_cd = KeymapKey(0, 1, 0, TD(1));
+    KeymapKey key_x    = KeymapKey(0, 2, 0, KC_X);
+
+    void SetUp() override {
+        set_keymap({dance_ab, dance_cd, key_x});
+    }
+};
+
+TEST_F(TapDanceBench, SingleTapTimeout) {
+    std::vector<BenchEvent> trace;
+    bench_tap(trace, dance_ab, 20, TAPPING_TERM + 20);
+
+    run_trace("single_tap_timeout", trace);
+}
+
+TEST_F(TapDanceBench, DoubleTap) {
+    std::vector<BenchEvent> trace;
+    bench_tap(trace, dance_ab, 20, 40);
+    bench_tap(trace, dance_ab, 20, TAPPING_TERM + 20);
+
+    run_trace("double_tap", trace);
+}
+
+TEST_F(TapDanceBench, InterruptedByOtherKeys) {
+    std::vector<BenchEvent> trace;
+    bench_tap(trace, dance_ab, 20, 20);
+    bench_tap(trace, key_x, 20, 20);
+    bench_tap(trace, dance_cd, 20, 20);
+    bench_tap(trace, key_x, 20, 40);
+
+    run_trace("interrupted_by_other_keys", trace);
+}
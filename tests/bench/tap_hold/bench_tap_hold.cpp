@@ -0,0 +1,57 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "bench_fixture.hpp"
+
+class TapHoldBench : public BenchFixture {};
+
+TEST_F(TapHoldBench, ModTapTyping) {
+    KeymapKey mod_tap = KeymapKey(0, 0, 0, SFT_T(KC_A));
+    KeymapKey key_b   = KeymapKey(0, 1, 0, KC_B);
+    KeymapKey key_c   = KeymapKey(0, 2, 0, KC_C);
+    set_keymap({mod_tap, key_b, key_c});
+
+    std::vector<BenchEvent> trace;
+    // Plain taps of the mod-tap key, interleaved with regular keys
+    bench_tap(trace, mod_tap, 30, 40);
+    bench_tap(trace, key_b, 30, 40);
+    bench_tap(trace, key_c, 30, 40);
+    // Rolling over from the mod-tap key into a regular key
+    trace.push_back(bench_press(mod_tap, 20));
+    trace.push_back(bench_press(key_b, 20));
+    trace.push_back(bench_release(mod_tap, 10));
+    trace.push_back(bench_release(key_b, 40));
+
+    run_trace("mod_tap_typing", trace);
+}
+
+TEST_F(TapHoldBench, ModTapHold) {
+    KeymapKey mod_tap = KeymapKey(0, 0, 0, SFT_T(KC_A));
+    KeymapKey key_b   = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({mod_tap, key_b});
+
+    std::vector<BenchEvent> trace;
+    // Hold past the tapping term, then use it as shift
+    trace.push_back(bench_press(mod_tap, TAPPING_TERM + 10));
+    bench_tap(trace, key_b, 30, 30);
+    trace.push_back(bench_release(mod_tap, 50));
+
+    run_trace("mod_tap_hold", trace);
+}
+
+TEST_F(TapHoldBench, LayerTapHold) {
+    KeymapKey layer_tap = KeymapKey(0, 0, 0, LT(1, KC_A));
+    KeymapKey key_b     = KeymapKey(0, 1, 0, KC_B);
+    KeymapKey key_1     = KeymapKey(1, 1, 0, KC_1);
+    set_keymap({layer_tap, key_b, key_1});
+
+    std::vector<BenchEvent> trace;
+    bench_tap(trace, layer_tap, 30, 40);
+    trace.push_back(bench_press(layer_tap, TAPPING_TERM + 10));
+    bench_tap(trace, key_b, 30, 30);
+    trace.push_back(bench_release(layer_tap, 50));
+
+    run_trace("layer_tap_hold", trace);
+}
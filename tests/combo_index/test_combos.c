@@ -0,0 +1,18 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { ab_esc, abc_tab, cd_space };
+
+uint16_t const ab_combo[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const abc_combo[] = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const cd_combo[]  = {KC_C, KC_D, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_esc]   = COMBO(ab_combo, KC_ESC),
+    [abc_tab]  = COMBO(abc_combo, KC_TAB),
+    [cd_space] = COMBO(cd_combo, KC_SPACE),
+};
+// clang-format on
@@ -0,0 +1,5 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+DEADLINE_SCHEDULER_ENABLE = yes
+CAPS_WORD_ENABLE = yes
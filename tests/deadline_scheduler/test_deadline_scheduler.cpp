@@ -0,0 +1,122 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "deadline_scheduler.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::AnyOf;
+using testing::InSequence;
+
+class DeadlineScheduler : public TestFixture {
+   public:
+    void SetUp() override {
+        caps_word_off();
+        for (uint8_t i = 0; i < DEADLINE_COUNT; i++) {
+            deadline_clear((deadline_id_t)i);
+        }
+    }
+};
+
+TEST_F(DeadlineScheduler, DeadlineIsOnlyDueOnceReached) {
+    TestDriver driver;
+    EXPECT_EQ(deadline_due(), 0);
+
+    deadline_set(DEADLINE_LEADER, 10);
+    idle_for(9);
+    EXPECT_EQ(deadline_due(), 0);
+
+    idle_for(1);
+    EXPECT_EQ(deadline_due(), DEADLINE_BIT(DEADLINE_LEADER));
+
+    /* A reached deadline stays due until its task re-arms or clears it. */
+    idle_for(5);
+    EXPECT_EQ(deadline_due(), DEADLINE_BIT(DEADLINE_LEADER));
+
+    deadline_clear(DEADLINE_LEADER);
+    EXPECT_EQ(deadline_due(), 0);
+}
+
+TEST_F(DeadlineScheduler, EarliestDeadlineWins) {
+    TestDriver driver;
+    deadline_set(DEADLINE_SECURE, 50);
+    deadline_set(DEADLINE_COMBO, 20);
+
+    idle_for(20);
+    EXPECT_EQ(deadline_due(), DEADLINE_BIT(DEADLINE_COMBO));
+
+    deadline_clear(DEADLINE_COMBO);
+    idle_for(29);
+    EXPECT_EQ(deadline_due(), 0);
+
+    idle_for(1);
+    EXPECT_EQ(deadline_due(), DEADLINE_BIT(DEADLINE_SECURE));
+}
+
+TEST_F(DeadlineScheduler, WakeMakesTaskDueImmediately) {
+    deadline_wake(DEADLINE_TAP_DANCE);
+    EXPECT_EQ(deadline_due(), DEADLINE_BIT(DEADLINE_TAP_DANCE));
+
+    deadline_wake_all();
+    EXPECT_EQ(deadline_due(), DEADLINE_BIT(DEADLINE_COUNT) - 1);
+}
+
+TEST_F(DeadlineScheduler, CapsWordIdleTimeoutStillFires) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    // clang-format off
+    EXPECT_CALL(driver, send_keyboard_mock(AnyOf(
+                KeyboardReport(),
+                KeyboardReport(KC_LSFT))))
+        .Times(AnyNumber());
+    // clang-format on
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+
+    caps_word_on();
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Caps Word is re-armed for its idle timeout rather than polled every scan. */
+    run_one_scan_loop();
+    EXPECT_FALSE(deadline_due() & DEADLINE_BIT(DEADLINE_CAPS_WORD));
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(CAPS_WORD_IDLE_TIMEOUT);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(is_caps_word_on());
+    EXPECT_EQ(get_mods() | get_weak_mods(), 0);
+    EXPECT_FALSE(deadline_due() & DEADLINE_BIT(DEADLINE_CAPS_WORD));
+}
+
+TEST_F(DeadlineScheduler, ModTapHoldStillResolvesWithTicksGated) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_hold_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
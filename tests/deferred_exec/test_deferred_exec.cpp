@@ -0,0 +1,135 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+}
+
+#define TABLE_COUNT 4
+
+namespace {
+
+struct callback_state {
+    std::vector<int> *log;
+    int               id;
+    uint32_t          repeat;
+};
+
+uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    auto *state = static_cast<callback_state *>(cb_arg);
+    state->log->push_back(state->id);
+    return state->repeat;
+}
+
+} // namespace
+
+class DeferredExec : public TestFixture {
+   public:
+    deferred_executor_t table[TABLE_COUNT] = {};
+    uint32_t            last_exec          = 0;
+    std::vector<int>    log;
+
+    void run_task(void) {
+        deferred_exec_advanced_task(table, TABLE_COUNT, &last_exec);
+    }
+};
+
+TEST_F(DeferredExec, CallbacksRunInTriggerOrder) {
+    TestDriver driver;
+    callback_state a{&log, 1, 0}, b{&log, 2, 0}, c{&log, 3, 0};
+
+    EXPECT_NE(defer_exec_advanced(table, TABLE_COUNT, 30, record_callback, &a), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, TABLE_COUNT, 10, record_callback, &b), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(defer_exec_advanced(table, TABLE_COUNT, 20, record_callback, &c), INVALID_DEFERRED_TOKEN);
+
+    idle_for(9);
+    run_task();
+    EXPECT_TRUE(log.empty());
+
+    idle_for(30);
+    run_task();
+    EXPECT_EQ(log, (std::vector<int>{2, 3, 1}));
+}
+
+TEST_F(DeferredExec, TableFullAndSlotReuse) {
+    callback_state  state{&log, 1, 0};
+    deferred_token tokens[TABLE_COUNT];
+
+    for (int i = 0; i < TABLE_COUNT; ++i) {
+        tokens[i] = defer_exec_advanced(table, TABLE_COUNT, 10 + i, record_callback, &state);
+        EXPECT_NE(tokens[i], INVALID_DEFERRED_TOKEN);
+        for (int j = 0; j < i; ++j) {
+            EXPECT_NE(tokens[i], tokens[j]);
+        }
+    }
+    EXPECT_EQ(defer_exec_advanced(table, TABLE_COUNT, 10, record_callback, &state), INVALID_DEFERRED_TOKEN);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_COUNT, tokens[1]));
+    deferred_token reused = defer_exec_advanced(table, TABLE_COUNT, 10, record_callback, &state);
+    EXPECT_NE(reused, INVALID_DEFERRED_TOKEN);
+
+    /* The cancelled token stays invalid even though its slot is in use again. */
+    EXPECT_NE(reused, tokens[1]);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_COUNT, tokens[1]));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, TABLE_COUNT, tokens[1], 10));
+}
+
+TEST_F(DeferredExec, LargeTableRejectsStaleTokens) {
+    callback_state      state{&log, 1, 0};
+    deferred_executor_t large_table[128] = {};
+
+    /* Leave a single free slot, so that every new callback reuses it. */
+    for (int i = 0; i < 127; ++i) {
+        EXPECT_NE(defer_exec_advanced(large_table, 128, 100, record_callback, &state), INVALID_DEFERRED_TOKEN);
+    }
+
+    std::vector<deferred_token> stale;
+    for (int i = 0; i < 16; ++i) {
+        deferred_token token = defer_exec_advanced(large_table, 128, 100, record_callback, &state);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        for (deferred_token old : stale) {
+            EXPECT_NE(token, old);
+            EXPECT_FALSE(extend_deferred_exec_advanced(large_table, 128, old, 10));
+        }
+        EXPECT_TRUE(cancel_deferred_exec_advanced(large_table, 128, token));
+        stale.push_back(token);
+    }
+}
+
+TEST_F(DeferredExec, ExtendReordersCallbacks) {
+    TestDriver driver;
+    callback_state a{&log, 1, 0}, b{&log, 2, 0};
+
+    deferred_token token_a = defer_exec_advanced(table, TABLE_COUNT, 10, record_callback, &a);
+    defer_exec_advanced(table, TABLE_COUNT, 20, record_callback, &b);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, TABLE_COUNT, token_a, 30));
+
+    idle_for(25);
+    run_task();
+    EXPECT_EQ(log, (std::vector<int>{2}));
+
+    idle_for(10);
+    run_task();
+    EXPECT_EQ(log, (std::vector<int>{2, 1}));
+}
+
+TEST_F(DeferredExec, RepeatingCallbackRunsOncePerPass) {
+    TestDriver driver;
+    callback_state fast{&log, 1, 1}, slow{&log, 2, 0};
+
+    defer_exec_advanced(table, TABLE_COUNT, 1, record_callback, &fast);
+    defer_exec_advanced(table, TABLE_COUNT, 5, record_callback, &slow);
+
+    /* Fall well behind schedule, the repeating callback must not starve the other one. */
+    idle_for(10);
+    run_task();
+    EXPECT_EQ(log, (std::vector<int>{1, 2}));
+
+    idle_for(1);
+    run_task();
+    EXPECT_EQ(log, (std::vector<int>{1, 2, 1}));
+}
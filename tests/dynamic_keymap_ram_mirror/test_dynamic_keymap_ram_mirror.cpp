@@ -0,0 +1,99 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "keymap_introspection.h"
+}
+
+#define KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+class DynamicKeymapRamMirror : public TestFixture {
+   public:
+    uint8_t *keymap_eeprom = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 0, 0);
+
+    void SetUp() override {
+        dynamic_keymap_reset();
+    }
+
+    std::vector<uint8_t> read_eeprom(uint16_t offset, uint16_t size) {
+        std::vector<uint8_t> bytes(size);
+        eeprom_read_block(bytes.data(), keymap_eeprom + offset, size);
+        return bytes;
+    }
+};
+
+TEST_F(DynamicKeymapRamMirror, SetBufferAtOddOffsetKeepsUntouchedHalfWords) {
+    dynamic_keymap_set_keycode(0, 0, 1, 0xAB00);
+    dynamic_keymap_set_keycode(0, 0, 3, 0x00CD);
+
+    /* Bytes 3 to 6 cover the low byte of key 1, all of key 2 and the high byte of key 3. */
+    uint8_t data[] = {0x11, 0x22, 0x33, 0x44};
+    dynamic_keymap_set_buffer(3, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), 0xAB11);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 2), 0x2233);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 3), 0x44CD);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 4), KC_NO);
+    EXPECT_EQ(read_eeprom(0, 10), (std::vector<uint8_t>{0x00, 0x00, 0xAB, 0x11, 0x22, 0x33, 0x44, 0xCD, 0x00, 0x00}));
+
+    uint8_t readback[sizeof(data)];
+    dynamic_keymap_get_buffer(3, sizeof(readback), readback);
+    EXPECT_EQ(std::vector<uint8_t>(readback, readback + sizeof(readback)), std::vector<uint8_t>(data, data + sizeof(data)));
+}
+
+TEST_F(DynamicKeymapRamMirror, SetBufferOnlyWritesChangedWords) {
+    /* Change key 2 behind the mirror's back, it must not be rewritten as the buffer leaves it unchanged. */
+    eeprom_update_word((uint16_t *)(keymap_eeprom + 4), 0xFFFF);
+
+    uint8_t data[] = {0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03};
+    dynamic_keymap_set_buffer(0, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0x0001);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), 0x0002);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 3), 0x0003);
+    EXPECT_EQ(read_eeprom(0, 8), (std::vector<uint8_t>{0x00, 0x01, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03}));
+}
+
+TEST_F(DynamicKeymapRamMirror, SetBufferClampsAtEndOfKeymap) {
+    uint8_t guard[] = {0x5A, 0x5A, 0x5A};
+    eeprom_update_block(guard, keymap_eeprom + KEYMAP_SIZE, sizeof(guard));
+
+    uint8_t data[] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC};
+    dynamic_keymap_set_buffer(KEYMAP_SIZE - 3, sizeof(data), data);
+
+    const uint8_t last_layer = DYNAMIC_KEYMAP_LAYER_COUNT - 1;
+    EXPECT_EQ(dynamic_keymap_get_keycode(last_layer, MATRIX_ROWS - 1, MATRIX_COLS - 2) & 0xFF, 0x12);
+    EXPECT_EQ(dynamic_keymap_get_keycode(last_layer, MATRIX_ROWS - 1, MATRIX_COLS - 1), 0x3456);
+    EXPECT_EQ(read_eeprom(KEYMAP_SIZE - 3, 6), (std::vector<uint8_t>{0x12, 0x34, 0x56, 0x5A, 0x5A, 0x5A}));
+
+    uint8_t readback[4];
+    dynamic_keymap_get_buffer(KEYMAP_SIZE - 2, sizeof(readback), readback);
+    EXPECT_EQ(std::vector<uint8_t>(readback, readback + sizeof(readback)), (std::vector<uint8_t>{0x34, 0x56, 0x00, 0x00}));
+}
+
+TEST_F(DynamicKeymapRamMirror, ResetAfterEepromEraseRestoresDefaults) {
+    /* Load the mirror, then erase the EEPROM underneath it as eeconfig_init() does. */
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), keycode_at_keymap_location_raw(0, 0, 0));
+    std::vector<uint8_t> erased(KEYMAP_SIZE, 0xFF);
+    eeprom_update_block(erased.data(), keymap_eeprom, KEYMAP_SIZE);
+
+    dynamic_keymap_reset();
+
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint16_t expected = keycode_at_keymap_location_raw(layer, row, col);
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, col), expected);
+                EXPECT_EQ(eeprom_read_byte((uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, col)), expected >> 8);
+                EXPECT_EQ(eeprom_read_byte((uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, col) + 1), expected & 0xFF);
+            }
+        }
+    }
+}
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Fewer than the overrides in test_key_overrides.c, so the linear scan is used
+#define KEY_OVERRIDE_INDEX_LENGTH 2
@@ -0,0 +1,96 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class KeyOverrideIndexOverflow : public TestFixture {};
+
+TEST_F(KeyOverrideIndexOverflow, first_override_activates) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndexOverflow, override_past_index_length_activates) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_gui(0, 0, 0, KC_LGUI);
+    KeymapKey  key_2(0, 1, 0, KC_2);
+    set_keymap({key_gui, key_2});
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    key_gui.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F2));
+    EXPECT_REPORT(driver, (KC_LGUI));
+    tap_key(key_2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndexOverflow, negative_mods_block_override) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_ctrl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_alt(0, 1, 0, KC_LALT);
+    KeymapKey  key_1(0, 2, 0, KC_1);
+    set_keymap({key_ctrl, key_alt, key_1});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT));
+    key_ctrl.press();
+    run_one_scan_loop();
+    key_alt.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT, KC_1));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT));
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_alt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
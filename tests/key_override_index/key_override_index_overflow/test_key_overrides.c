@@ -0,0 +1,14 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+const key_override_t shift_bspc_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t ctrl_1_override     = ko_make_with_layers_and_negmods(MOD_MASK_CTRL, KC_1, KC_F1, ~0, MOD_MASK_ALT);
+const key_override_t gui_2_override      = ko_make_basic(MOD_MASK_GUI, KC_2, KC_F2);
+
+const key_override_t *key_overrides[] = {
+    &shift_bspc_override,
+    &ctrl_1_override,
+    &gui_2_override,
+};
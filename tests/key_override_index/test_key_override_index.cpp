@@ -0,0 +1,204 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+extern const key_override_t  shift_bspc_override;
+extern const key_override_t  shift_3_override;
+extern const key_override_t *key_overrides[];
+}
+
+class KeyOverrideIndex : public TestFixture {};
+
+TEST_F(KeyOverrideIndex, override_for_trigger_activates) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, keys_without_override_pass_through) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    set_keymap({key_shift, key_a});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, negative_mods_block_override) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_ctrl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_alt(0, 1, 0, KC_LALT);
+    KeymapKey  key_1(0, 2, 0, KC_1);
+    set_keymap({key_ctrl, key_alt, key_1});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT));
+    key_ctrl.press();
+    run_one_scan_loop();
+    key_alt.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT, KC_1));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT));
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_alt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, trigger_bucket_merged_with_kc_no_bucket_in_table_order) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_gui(0, 0, 0, KC_LGUI);
+    KeymapKey  key_2(0, 1, 0, KC_2);
+    KeymapKey  key_3(0, 2, 0, KC_3);
+    set_keymap({key_gui, key_2, key_3});
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    key_gui.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // gui_2_override comes before gui_any_override in the table, although KC_NO sorts first
+    EXPECT_REPORT(driver, (KC_F2));
+    EXPECT_REPORT(driver, (KC_LGUI));
+    tap_key(key_2);
+    VERIFY_AND_CLEAR(driver);
+
+    // Keys without a bucket of their own still reach the KC_NO bucket. Without a trigger the key is sent as well, and the override stays active until the mods are released.
+    EXPECT_REPORT(driver, (KC_3, KC_F3));
+    EXPECT_REPORT(driver, (KC_F3));
+    tap_key(key_3);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    EXPECT_EMPTY_REPORT(driver);
+    key_gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, mod_down_activates_override_for_last_key_down) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The modifier event looks up the bucket of the held trigger, the replacement follows after KEY_OVERRIDE_REPEAT_DELAY
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_shift.press();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_bspc.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, invalidate_picks_up_changed_overrides) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    KeymapKey  key_3(0, 2, 0, KC_3);
+    set_keymap({key_shift, key_bspc, key_3});
+
+    key_overrides[0] = &shift_3_override;
+    key_override_index_invalidate();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F4));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_3);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_BSPC));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    key_overrides[0] = &shift_bspc_override;
+    key_override_index_invalidate();
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,97 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerLookupCache : public TestFixture {};
+
+TEST_F(LayerLookupCache, TransparentKeyFallsThroughToLowerLayer) {
+    TestDriver driver;
+    KeymapKey  layer_key   = KeymapKey{0, 0, 0, MO(1)};
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+    KeymapKey  trans_key   = KeymapKey{1, 1, 0, KC_TRNS};
+
+    set_keymap({layer_key, regular_key, trans_key});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(1));
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, LayerChangeRefreshesCachedLayer) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  layer_key   = KeymapKey{0, 0, 0, MO(1)};
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+    KeymapKey  overlay_key = KeymapKey{1, 1, 0, KC_B};
+
+    set_keymap({layer_key, regular_key, overlay_key});
+
+    /* Populate the cache with layer 0. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    /* Layer 1 shadows the cached entry. */
+    layer_key.press();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_key.release();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, KeymapChangeIsPickedUp) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_TRNS}});
+    layer_on(1);
+
+    /* Layer 1 is transparent for the key, so it resolves to the default layer. */
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    /* Map the key on layer 1, the fixture invalidates the cache on keymap changes. */
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_B}});
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+
+    /* Invalidating a single key must not disturb the result either. */
+    layer_lookup_cache_invalidate_key(regular_key.position);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,99 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ReportCoalescing : public TestFixture {};
+
+TEST_F(ReportCoalescing, keys_changed_in_one_scan_are_sent_together) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_b(0, 0, 0, KC_B);
+    KeymapKey  key_c(0, 1, 1, KC_C);
+    set_keymap({key_b, key_c});
+
+    key_b.press();
+    key_c.press();
+    EXPECT_REPORT(driver, (KC_B, KC_C));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    key_c.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, modifier_and_key_pressed_in_one_scan_are_sent_together) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lsft(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    set_keymap({key_lsft, key_a});
+
+    key_lsft.press();
+    key_a.press();
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_lsft.release();
+    key_a.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, modifier_changed_after_key_is_sent_separately) {
+    TestDriver driver;
+    InSequence s;
+
+    // The host must see the key before the modifier that follows it
+    host_report_transaction_begin();
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    register_code(KC_A);
+    register_code(KC_LSFT);
+    host_report_transaction_end();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    clear_keyboard();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, tap_in_one_scan_is_not_merged) {
+    TestDriver driver;
+    InSequence s;
+
+    host_report_transaction_begin();
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_code(KC_X);
+    host_report_transaction_end();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, wait_sends_held_back_report) {
+    TestDriver driver;
+    InSequence s;
+
+    host_report_transaction_begin();
+    register_code(KC_X);
+    EXPECT_REPORT(driver, (KC_X));
+    wait_ms(10);
+    VERIFY_AND_CLEAR(driver);
+
+    unregister_code(KC_X);
+    EXPECT_EMPTY_REPORT(driver);
+    host_report_transaction_end();
+    VERIFY_AND_CLEAR(driver);
+}
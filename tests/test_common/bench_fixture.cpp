@@ -0,0 +1,163 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench_fixture.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include "gmock/gmock.h"
+#include "test_driver.hpp"
+
+extern "C" {
+#include "action.h"
+#include "debug.h"
+#include "keyboard.h"
+#include "matrix.h"
+#include "test_matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+struct BenchResult {
+    std::string name;
+    unsigned    iterations;
+    size_t      events;
+    uint64_t    total_ns;
+    uint64_t    p50_ns;
+    uint64_t    p99_ns;
+    uint64_t    max_ns;
+    uint64_t    action_execs;
+    uint64_t    scans;
+};
+
+/* Collects the results of every benchmark in the executable and writes them out at exit, either to the file named by
+ * QMK_BENCH_OUTPUT or to stdout. */
+class BenchReport {
+   public:
+    ~BenchReport() {
+        if (results.empty()) {
+            return;
+        }
+
+        const char* path = std::getenv("QMK_BENCH_OUTPUT");
+        FILE*       out  = path ? std::fopen(path, "w") : stdout;
+        if (!out) {
+            std::fprintf(stderr, "unable to write benchmark results to %s\n", path);
+            return;
+        }
+
+        std::fprintf(out, "{\n  \"benchmarks\": [\n");
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r      = results[i];
+            uint64_t           events = (uint64_t)r.iterations * r.events;
+            std::fprintf(out, "    {\n");
+            std::fprintf(out, "      \"name\": \"%s\",\n", r.name.c_str());
+            std::fprintf(out, "      \"iterations\": %u,\n", r.iterations);
+            std::fprintf(out, "      \"events\": %llu,\n", (unsigned long long)events);
+            std::fprintf(out, "      \"total_ns\": %llu,\n", (unsigned long long)r.total_ns);
+            std::fprintf(out, "      \"mean_ns_per_event\": %.1f,\n", (double)r.total_ns / events);
+            std::fprintf(out, "      \"p50_ns_per_event\": %llu,\n", (unsigned long long)r.p50_ns);
+            std::fprintf(out, "      \"p99_ns_per_event\": %llu,\n", (unsigned long long)r.p99_ns);
+            std::fprintf(out, "      \"max_ns_per_event\": %llu,\n", (unsigned long long)r.max_ns);
+            std::fprintf(out, "      \"action_exec_per_event\": %.2f,\n", (double)r.action_execs / events);
+            std::fprintf(out, "      \"scans_per_event\": %.2f\n", (double)r.scans / events);
+            std::fprintf(out, "    }%s\n", i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(out, "  ]\n}\n");
+
+        if (out != stdout) {
+            std::fclose(out);
+        }
+    }
+
+    std::vector<BenchResult> results;
+};
+
+BenchReport bench_report;
+
+/* Per thread CPU time where available, so that other processes on the host do not skew the numbers. */
+uint64_t bench_now_ns(void) {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+} // namespace
+
+BenchEvent bench_press(const KeymapKey& key, unsigned delay_ms) {
+    return BenchEvent{key.position, true, delay_ms};
+}
+
+BenchEvent bench_release(const KeymapKey& key, unsigned delay_ms) {
+    return BenchEvent{key.position, false, delay_ms};
+}
+
+void bench_tap(std::vector<BenchEvent>& trace, const KeymapKey& key, unsigned hold_ms, unsigned gap_ms) {
+    trace.push_back(bench_press(key, hold_ms));
+    trace.push_back(bench_release(key, gap_ms));
+}
+
+void BenchFixture::run_trace(const std::string& name, const std::vector<BenchEvent>& trace, unsigned iterations) {
+    /* Reports are not checked here, the functional tests take care of that. */
+    testing::NiceMock<TestDriver> driver;
+
+    /* Debug output would dominate the measurements. */
+    debug_config_t saved_debug = debug_config;
+    debug_config.raw           = 0;
+
+    BenchResult result{name, iterations, trace.size(), 0, 0, 0, 0, 0, 0};
+
+    std::vector<uint64_t> samples;
+    samples.reserve((size_t)iterations * trace.size());
+
+    uint32_t action_exec_start = action_exec_count;
+    for (unsigned i = 0; i < iterations; ++i) {
+        for (const BenchEvent& event : trace) {
+            if (event.pressed) {
+                press_key(event.position.col, event.position.row);
+            } else {
+                release_key(event.position.col, event.position.row);
+            }
+
+            /* Scan exactly like TestFixture::idle_for(), minus the logging. */
+            unsigned scans = event.delay_ms ? event.delay_ms : 1;
+            uint64_t start = bench_now_ns();
+            for (unsigned scan = 0; scan < scans; ++scan) {
+                keyboard_task();
+                housekeeping_task();
+                advance_time(1);
+            }
+            uint64_t elapsed = bench_now_ns() - start;
+
+            samples.push_back(elapsed);
+            result.total_ns += elapsed;
+            result.scans += scans;
+        }
+    }
+    result.action_execs = action_exec_count - action_exec_start;
+
+    std::sort(samples.begin(), samples.end());
+    if (!samples.empty()) {
+        result.p50_ns = samples[(samples.size() - 1) * 50 / 100];
+        result.p99_ns = samples[(samples.size() - 1) * 99 / 100];
+        result.max_ns = samples.back();
+    }
+
+    debug_config = saved_debug;
+    bench_report.results.push_back(result);
+
+    /* Traces must leave every key released so that iterations are independent. */
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+        for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+            EXPECT_FALSE(matrix_is_on(row, col)) << name << " leaves (" << +col << "," << +row << ") pressed";
+        }
+    }
+}
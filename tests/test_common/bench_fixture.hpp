@@ -0,0 +1,37 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+/**
+ * @brief One step of a recorded keystroke trace: `key` changes state, then the keyboard scans for `delay_ms` milliseconds.
+ */
+struct BenchEvent {
+    keypos_t position;
+    bool     pressed;
+    unsigned delay_ms;
+};
+
+BenchEvent bench_press(const KeymapKey& key, unsigned delay_ms = 1);
+BenchEvent bench_release(const KeymapKey& key, unsigned delay_ms = 1);
+
+/**
+ * @brief Appends a tap of `key`, held for `hold_ms` and followed by `gap_ms` of idle scanning.
+ */
+void bench_tap(std::vector<BenchEvent>& trace, const KeymapKey& key, unsigned hold_ms = 10, unsigned gap_ms = 20);
+
+class BenchFixture : public TestFixture {
+   public:
+    /**
+     * @brief Replays `trace` `iterations` times through keyboard_task() with the mock timer.
+     *
+     * Host CPU time and action_exec() calls are attributed to the event that preceded them, and the results are
+     * written out as JSON under `name` once all benchmarks have run.
+     */
+    void run_trace(const std::string& name, const std::vector<BenchEvent>& trace, unsigned iterations = 1000);
+};
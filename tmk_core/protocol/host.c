@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode.h"
 #include "host.h"
@@ -44,6 +45,38 @@ static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+#ifdef HOST_REPORT_COALESCING
+typedef enum {
+    HOST_REPORT_NONE,
+    HOST_REPORT_KEYBOARD,
+    HOST_REPORT_NKRO,
+    HOST_REPORT_MOUSE,
+    HOST_REPORT_SYSTEM,
+    HOST_REPORT_CONSUMER,
+} host_report_type_t;
+
+typedef union {
+    report_keyboard_t keyboard;
+#    ifdef NKRO_ENABLE
+    report_nkro_t nkro;
+#    endif
+    report_mouse_t mouse;
+    uint16_t       usage;
+} host_report_t;
+
+static bool               transaction_open = false;
+static bool               flushing         = false;
+static host_report_type_t pending_type     = HOST_REPORT_NONE;
+static host_report_t      pending_report;
+
+// The last reports the host has seen
+static report_keyboard_t sent_keyboard_report;
+#    ifdef NKRO_ENABLE
+static report_nkro_t sent_nkro_report;
+#    endif
+static report_mouse_t sent_mouse_report;
+#endif
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
 }
@@ -71,8 +104,161 @@ led_t host_keyboard_led_state(void) {
     return (led_t)host_keyboard_leds();
 }
 
+#ifdef HOST_REPORT_COALESCING
+static bool keyboard_report_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Whether the host has to see the pending keyboard report before `report`,
+ * because a key or modifier changes back, or modifiers change after keys did */
+static bool keyboard_report_needs_split(const report_keyboard_t *pending, const report_keyboard_t *sent, const report_keyboard_t *report) {
+    if ((pending->mods ^ sent->mods) & ~(report->mods ^ sent->mods)) {
+        return true;
+    }
+
+    bool keys_changed = false;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = pending->keys[i];
+        if (key && !keyboard_report_has_key(sent, key)) {
+            keys_changed = true;
+            if (!keyboard_report_has_key(report, key)) {
+                return true;
+            }
+        }
+        key = sent->keys[i];
+        if (key && !keyboard_report_has_key(pending, key)) {
+            keys_changed = true;
+            if (keyboard_report_has_key(report, key)) {
+                return true;
+            }
+        }
+    }
+
+    return keys_changed && report->mods != pending->mods;
+}
+
+#    ifdef NKRO_ENABLE
+static bool nkro_report_needs_split(const report_nkro_t *pending, const report_nkro_t *sent, const report_nkro_t *report) {
+    if ((pending->mods ^ sent->mods) & ~(report->mods ^ sent->mods)) {
+        return true;
+    }
+
+    bool keys_changed = false;
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        uint8_t changed = pending->bits[i] ^ sent->bits[i];
+        if (changed & ~(report->bits[i] ^ sent->bits[i])) {
+            return true;
+        }
+        keys_changed |= changed != 0;
+    }
+
+    return keys_changed && report->mods != pending->mods;
+}
+#    endif
+
+static bool mouse_report_needs_split(const report_mouse_t *pending, const report_mouse_t *sent, const report_mouse_t *report) {
+    // Movement is relative, so it is never merged
+    if (pending->x || pending->y || pending->v || pending->h) {
+        return true;
+    }
+    return (pending->buttons ^ sent->buttons) & ~(report->buttons ^ sent->buttons);
+}
+
+/* Holds back a report during a transaction. Returns false if it has to be
+ * sent right away instead. */
+static bool host_report_defer(host_report_type_t type, const void *report, size_t size) {
+    if (!transaction_open || flushing) {
+        return false;
+    }
+
+    if (pending_type != type) {
+        // Keep the order between report types
+        host_report_flush();
+    } else {
+        bool split;
+        switch (type) {
+            case HOST_REPORT_KEYBOARD:
+                split = keyboard_report_needs_split(&pending_report.keyboard, &sent_keyboard_report, report);
+                break;
+#    ifdef NKRO_ENABLE
+            case HOST_REPORT_NKRO:
+                split = nkro_report_needs_split(&pending_report.nkro, &sent_nkro_report, report);
+                break;
+#    endif
+            case HOST_REPORT_MOUSE:
+                split = mouse_report_needs_split(&pending_report.mouse, &sent_mouse_report, report);
+                break;
+            default:
+                // A usage that changes back, such as a tap of a consumer key
+                split = *(const uint16_t *)report == (type == HOST_REPORT_SYSTEM ? last_system_usage : last_consumer_usage);
+                break;
+        }
+        if (split) {
+            host_report_flush();
+        }
+    }
+
+    pending_type = type;
+    memcpy(&pending_report, report, size);
+    return true;
+}
+
+void host_report_transaction_begin(void) {
+    transaction_open = true;
+}
+
+void host_report_transaction_end(void) {
+    host_report_flush();
+    transaction_open = false;
+}
+
+void host_report_flush(void) {
+    if (pending_type == HOST_REPORT_NONE || flushing) {
+        return;
+    }
+
+    // The report is sent through the regular path, which must not defer it again
+    flushing = true;
+    switch (pending_type) {
+        case HOST_REPORT_KEYBOARD:
+            host_keyboard_send(&pending_report.keyboard);
+            break;
+#    ifdef NKRO_ENABLE
+        case HOST_REPORT_NKRO:
+            host_nkro_send(&pending_report.nkro);
+            break;
+#    endif
+        case HOST_REPORT_MOUSE:
+            host_mouse_send(&pending_report.mouse);
+            break;
+        case HOST_REPORT_SYSTEM:
+            host_system_send(pending_report.usage);
+            break;
+        case HOST_REPORT_CONSUMER:
+            host_consumer_send(pending_report.usage);
+            break;
+        default:
+            break;
+    }
+    pending_type = HOST_REPORT_NONE;
+    flushing     = false;
+}
+#endif
+
 /* send report */
 void host_keyboard_send(report_keyboard_t *report) {
+#ifdef HOST_REPORT_COALESCING
+    if (host_report_defer(HOST_REPORT_KEYBOARD, report, sizeof(report_keyboard_t))) {
+        return;
+    }
+    memcpy(&sent_keyboard_report, report, sizeof(report_keyboard_t));
+#endif
+
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
         bluetooth_send_keyboard(report);
@@ -96,6 +282,13 @@ void host_keyboard_send(report_keyboard_t *report) {
 }
 
 void host_nkro_send(report_nkro_t *report) {
+#if defined(HOST_REPORT_COALESCING) && defined(NKRO_ENABLE)
+    if (host_report_defer(HOST_REPORT_NKRO, report, sizeof(report_nkro_t))) {
+        return;
+    }
+    memcpy(&sent_nkro_report, report, sizeof(report_nkro_t));
+#endif
+
     if (!driver) return;
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
@@ -110,6 +303,13 @@ void host_nkro_send(report_nkro_t *report) {
 }
 
 void host_mouse_send(report_mouse_t *report) {
+#ifdef HOST_REPORT_COALESCING
+    if (host_report_defer(HOST_REPORT_MOUSE, report, sizeof(report_mouse_t))) {
+        return;
+    }
+    memcpy(&sent_mouse_report, report, sizeof(report_mouse_t));
+#endif
+
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
         bluetooth_send_mouse(report);
@@ -130,6 +330,12 @@ void host_mouse_send(report_mouse_t *report) {
 }
 
 void host_system_send(uint16_t usage) {
+#ifdef HOST_REPORT_COALESCING
+    if (host_report_defer(HOST_REPORT_SYSTEM, &usage, sizeof(usage))) {
+        return;
+    }
+#endif
+
     if (usage == last_system_usage) return;
     last_system_usage = usage;
 
@@ -143,6 +349,12 @@ void host_system_send(uint16_t usage) {
 }
 
 void host_consumer_send(uint16_t usage) {
+#ifdef HOST_REPORT_COALESCING
+    if (host_report_defer(HOST_REPORT_CONSUMER, &usage, sizeof(usage))) {
+        return;
+    }
+#endif
+
     if (usage == last_consumer_usage) return;
     last_consumer_usage = usage;
 
@@ -164,6 +376,10 @@ void host_consumer_send(uint16_t usage) {
 
 #ifdef JOYSTICK_ENABLE
 void host_joystick_send(joystick_t *joystick) {
+#    ifdef HOST_REPORT_COALESCING
+    host_report_flush();
+#    endif
+
     if (!driver) return;
 
     report_joystick_t report = {
@@ -223,6 +439,10 @@ __attribute__((weak)) void send_joystick(report_joystick_t *report) {}
 
 #ifdef DIGITIZER_ENABLE
 void host_digitizer_send(digitizer_t *digitizer) {
+#    ifdef HOST_REPORT_COALESCING
+    host_report_flush();
+#    endif
+
     report_digitizer_t report = {
 #    ifdef DIGITIZER_SHARED_EP
         .report_id = REPORT_ID_DIGITIZER,
@@ -242,6 +462,10 @@ __attribute__((weak)) void send_digitizer(report_digitizer_t *report) {}
 
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
 void host_programmable_button_send(uint32_t data) {
+#    ifdef HOST_REPORT_COALESCING
+    host_report_flush();
+#    endif
+
     report_programmable_button_t report = {
         .report_id = REPORT_ID_PROGRAMMABLE_BUTTON,
         .usage     = data,
@@ -254,9 +478,19 @@ void host_programmable_button_send(uint32_t data) {
 __attribute__((weak)) void send_programmable_button(report_programmable_button_t *report) {}
 
 uint16_t host_last_system_usage(void) {
+#ifdef HOST_REPORT_COALESCING
+    if (pending_type == HOST_REPORT_SYSTEM) {
+        return pending_report.usage;
+    }
+#endif
     return last_system_usage;
 }
 
 uint16_t host_last_consumer_usage(void) {
+#ifdef HOST_REPORT_COALESCING
+    if (pending_type == HOST_REPORT_CONSUMER) {
+        return pending_report.usage;
+    }
+#endif
     return last_consumer_usage;
 }
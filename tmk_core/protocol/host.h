@@ -44,6 +44,17 @@ void    host_programmable_button_send(uint32_t data);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+#ifdef HOST_REPORT_COALESCING
+/* Holds back keyboard, NKRO, mouse, system and consumer reports until the
+ * transaction ends, so several changes in one scan go out as one report.
+ * Reports are still split where the host would otherwise miss a state. */
+void host_report_transaction_begin(void);
+void host_report_transaction_end(void);
+
+/* Sends the report held back by the current transaction, if any */
+void host_report_flush(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif